@@ -0,0 +1,274 @@
+#include "BinaryRoster.h"
+#include "FileHandler.h"
+#include "MappedFile.h"
+#include "StringPool.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const char MAGIC[4] = {'N', 'B', 'A', 'R'};
+
+struct FileHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t headerSize;
+    uint32_t playerCount;
+    uint32_t stringCount;
+    uint32_t stringBytes;
+    uint32_t teamNameId;
+    uint32_t bodySize;
+    uint32_t checksum;
+};
+static_assert(sizeof(FileHeader) == 32, "FileHeader must be 32 bytes");
+
+bool hostIsLittleEndian() {
+    const uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+size_t padTo(size_t offset, size_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+// Byte offsets of each section inside the body, derived from the header counts
+struct BodyLayout {
+    uint64_t offsets;
+    uint64_t strings;
+    uint64_t nameIds;       // first, last, position: uint32 columns
+    uint64_t intColumns;    // jersey, height, weight, age: int32 columns
+    uint64_t doubleColumns; // ppg, rpg, apg: float64 columns
+    uint64_t size;
+
+    BodyLayout(uint64_t players, uint64_t stringCount, uint64_t stringBytes) {
+        offsets = 0;
+        strings = offsets + (stringCount + 1) * sizeof(uint32_t);
+        nameIds = padTo(strings + stringBytes, sizeof(uint32_t));
+        intColumns = nameIds + 3 * players * sizeof(uint32_t);
+        doubleColumns = padTo(intColumns + 4 * players * sizeof(int32_t), sizeof(double));
+        size = doubleColumns + 3 * players * sizeof(double);
+    }
+};
+
+template <typename T>
+void putColumn(std::string& body, size_t offset, size_t row, T value) {
+    std::memcpy(&body[offset + row * sizeof(T)], &value, sizeof(T));
+}
+
+template <typename T>
+T getColumn(const char* body, size_t offset, size_t row) {
+    T value;
+    std::memcpy(&value, body + offset + row * sizeof(T), sizeof(T));
+    return value;
+}
+
+// Reflected CRC-32 (IEEE 802.3), one table entry per byte value
+struct CrcTable {
+    uint32_t entries[256];
+
+    CrcTable() {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            entries[i] = c;
+        }
+    }
+};
+
+} // namespace
+
+uint32_t crc32(const void* data, size_t length, uint32_t crc) {
+    static const CrcTable table;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    crc = ~crc;
+    for (size_t i = 0; i < length; ++i) {
+        crc = table.entries[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+bool saveRosterBinary(const Roster& roster, const std::string& filename) {
+    if (!hostIsLittleEndian()) {
+        std::cerr << "  Error: Binary rosters are only supported on little-endian hosts.\n";
+        return false;
+    }
+
+    const std::vector<Player>& players = roster.getPlayers();
+    size_t count = players.size();
+
+    // String table: team name first, then every distinct name and position
+    StringPool strings;
+    uint32_t teamNameId = strings.intern(roster.getTeamName());
+    std::vector<uint32_t> ids;
+    ids.reserve(count * 3);
+    for (const auto& player : players) {
+        ids.push_back(strings.intern(player.firstName.str()));
+        ids.push_back(strings.intern(player.lastName.str()));
+        ids.push_back(strings.intern(player.position.str()));
+    }
+    size_t stringBytes = 0;
+    for (size_t i = 0; i < strings.size(); ++i) {
+        stringBytes += strings.get(static_cast<uint32_t>(i)).size();
+    }
+
+    // Counts, string offsets and the body size are all 32-bit in the file
+    BodyLayout layout(count, strings.size(), stringBytes);
+    if (layout.size > std::numeric_limits<uint32_t>::max()) {
+        std::cerr << "  Error: Roster is too large for the binary format (4 GiB body limit).\n";
+        return false;
+    }
+    std::string body(layout.size, '\0');
+
+    uint32_t offset = 0;
+    for (size_t i = 0; i < strings.size(); ++i) {
+        const std::string& str = strings.get(static_cast<uint32_t>(i));
+        putColumn<uint32_t>(body, layout.offsets, i, offset);
+        std::memcpy(&body[layout.strings + offset], str.data(), str.size());
+        offset += static_cast<uint32_t>(str.size());
+    }
+    putColumn<uint32_t>(body, layout.offsets, strings.size(), offset);
+
+    size_t idColumn = count * sizeof(uint32_t);
+    size_t intColumn = count * sizeof(int32_t);
+    size_t doubleColumn = count * sizeof(double);
+    for (size_t row = 0; row < count; ++row) {
+        const Player& p = players[row];
+        putColumn<uint32_t>(body, layout.nameIds, row, ids[row * 3]);
+        putColumn<uint32_t>(body, layout.nameIds + idColumn, row, ids[row * 3 + 1]);
+        putColumn<uint32_t>(body, layout.nameIds + 2 * idColumn, row, ids[row * 3 + 2]);
+        putColumn<int32_t>(body, layout.intColumns, row, p.jerseyNumber);
+        putColumn<int32_t>(body, layout.intColumns + intColumn, row, p.heightInches);
+        putColumn<int32_t>(body, layout.intColumns + 2 * intColumn, row, p.weightLbs);
+        putColumn<int32_t>(body, layout.intColumns + 3 * intColumn, row, p.age);
+        putColumn<double>(body, layout.doubleColumns, row, p.pointsPerGame);
+        putColumn<double>(body, layout.doubleColumns + doubleColumn, row, p.reboundsPerGame);
+        putColumn<double>(body, layout.doubleColumns + 2 * doubleColumn, row, p.assistsPerGame);
+    }
+
+    FileHeader header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = BINARY_ROSTER_VERSION;
+    header.headerSize = sizeof(FileHeader);
+    header.playerCount = static_cast<uint32_t>(count);
+    header.stringCount = static_cast<uint32_t>(strings.size());
+    header.stringBytes = static_cast<uint32_t>(stringBytes);
+    header.teamNameId = teamNameId;
+    header.bodySize = static_cast<uint32_t>(body.size());
+    header.checksum = crc32(body.data(), body.size());
+
+    return writeFileAtomically(filename, [&](std::ostream& out) {
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(body.data(), static_cast<std::streamsize>(body.size()));
+    });
+}
+
+bool loadRosterBinary(Roster& roster, const std::string& filename) {
+    if (!hostIsLittleEndian()) {
+        std::cerr << "  Error: Binary rosters are only supported on little-endian hosts.\n";
+        return false;
+    }
+
+    MappedFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+    std::string_view data = file.view();
+
+    FileHeader header;
+    if (data.size() < sizeof(header)) {
+        std::cerr << "  Error: Binary roster is truncated.\n";
+        return false;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.version != BINARY_ROSTER_VERSION || header.headerSize != sizeof(FileHeader)) {
+        std::cerr << "  Error: Not a supported binary roster file.\n";
+        return false;
+    }
+
+    BodyLayout layout(header.playerCount, header.stringCount, header.stringBytes);
+    const char* body = data.data() + sizeof(header);
+    if (layout.size != header.bodySize || data.size() - sizeof(header) != layout.size ||
+        header.stringCount == 0 || header.teamNameId >= header.stringCount) {
+        std::cerr << "  Error: Binary roster is truncated or malformed.\n";
+        return false;
+    }
+    if (crc32(body, layout.size) != header.checksum) {
+        std::cerr << "  Error: Binary roster checksum mismatch.\n";
+        return false;
+    }
+
+    // Validate the string table once so rows can index it freely
+    std::vector<std::string_view> strings(header.stringCount);
+    uint32_t previous = 0;
+    for (uint32_t i = 0; i < header.stringCount; ++i) {
+        uint32_t begin = getColumn<uint32_t>(body, layout.offsets, i);
+        uint32_t end = getColumn<uint32_t>(body, layout.offsets, i + 1);
+        if (begin != previous || end < begin || end > header.stringBytes) {
+            std::cerr << "  Error: Binary roster string table is malformed.\n";
+            return false;
+        }
+        strings[i] = std::string_view(body + layout.strings + begin, end - begin);
+        previous = end;
+    }
+
+    size_t count = header.playerCount;
+    size_t idColumn = count * sizeof(uint32_t);
+    size_t intColumn = count * sizeof(int32_t);
+    size_t doubleColumn = count * sizeof(double);
+    std::vector<Player> players(count);
+    for (size_t row = 0; row < count; ++row) {
+        uint32_t first = getColumn<uint32_t>(body, layout.nameIds, row);
+        uint32_t last = getColumn<uint32_t>(body, layout.nameIds + idColumn, row);
+        uint32_t pos = getColumn<uint32_t>(body, layout.nameIds + 2 * idColumn, row);
+        if (first >= header.stringCount || last >= header.stringCount || pos >= header.stringCount) {
+            std::cerr << "  Error: Binary roster references a missing string.\n";
+            return false;
+        }
+        Player& p = players[row];
+        p.firstName = InternedString(strings[first]);
+        p.lastName = InternedString(strings[last]);
+        p.position = InternedString(strings[pos]);
+        p.jerseyNumber = getColumn<int32_t>(body, layout.intColumns, row);
+        p.heightInches = getColumn<int32_t>(body, layout.intColumns + intColumn, row);
+        p.weightLbs = getColumn<int32_t>(body, layout.intColumns + 2 * intColumn, row);
+        p.age = getColumn<int32_t>(body, layout.intColumns + 3 * intColumn, row);
+        p.pointsPerGame = getColumn<double>(body, layout.doubleColumns, row);
+        p.reboundsPerGame = getColumn<double>(body, layout.doubleColumns + doubleColumn, row);
+        p.assistsPerGame = getColumn<double>(body, layout.doubleColumns + 2 * doubleColumn, row);
+    }
+
+    // Same team name rule as the text loader
+    std::string_view teamName = strings[header.teamNameId];
+    if (!teamName.empty()) {
+        roster.setTeamName(std::string(teamName));
+    }
+    roster.setPlayers(std::move(players));
+    roster.markSaved();
+    return true;
+}
+
+bool isBinaryRosterFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(MAGIC)];
+    if (!file.read(magic, sizeof(magic))) {
+        return false;
+    }
+    return std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+bool convertRosterFile(const std::string& from, const std::string& to) {
+    Roster roster;
+    if (isBinaryRosterFile(from)) {
+        return loadRosterBinary(roster, from) && saveRoster(roster, to);
+    }
+    return loadRoster(roster, from) && saveRosterBinary(roster, to);
+}
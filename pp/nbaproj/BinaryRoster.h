@@ -0,0 +1,28 @@
+#ifndef BINARYROSTER_H
+#define BINARYROSTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "Roster.h"
+
+// Binary roster format (little-endian):
+//   32-byte header: "NBAR", version, header size, player count, string count,
+//                   string bytes, team name string id, body size, CRC-32 of body
+//   body:           string offsets, string bytes, then one column per Player
+//                   field (name/position ids, int32 stats, float64 averages)
+// Doubles are stored exactly, so a save/load round trip is lossless. Sizes
+// are 32-bit, so saving refuses a roster whose body would pass 4 GiB.
+const uint16_t BINARY_ROSTER_VERSION = 1;
+
+bool saveRosterBinary(const Roster& roster, const std::string& filename);
+bool loadRosterBinary(Roster& roster, const std::string& filename);
+bool isBinaryRosterFile(const std::string& filename);
+
+// Reads `from` in whichever format it is in and writes it to `to` in the
+// other; `roster_manager --convert FROM TO`
+bool convertRosterFile(const std::string& from, const std::string& to);
+
+uint32_t crc32(const void* data, size_t length, uint32_t crc = 0);
+
+#endif // BINARYROSTER_H
@@ -0,0 +1,93 @@
+#include "ConcurrentRoster.h"
+#include "Journal.h"
+#include <utility>
+
+ConcurrentRoster::Reader::Reader(const ConcurrentRoster& roster)
+    : source(&roster), cachedVersion(roster.version()) {
+    // Version first: a snapshot newer than it only costs one extra reload
+    cached = source->snapshot();
+}
+
+const Roster& ConcurrentRoster::Reader::current() {
+    uint64_t latest = source->version();
+    if (latest != cachedVersion) {
+        // The snapshot may already be newer than `latest`; the next call reloads it harmlessly
+        cachedVersion = latest;
+        cached = source->snapshot();
+    }
+    return *cached;
+}
+
+ConcurrentRoster::ConcurrentRoster(const std::string& name)
+    : state(std::make_shared<const Roster>(name)), committed(0) {}
+
+ConcurrentRoster::ConcurrentRoster(const Roster& initial)
+    : state(std::make_shared<const Roster>(initial)), committed(0) {}
+
+ConcurrentRoster::Snapshot ConcurrentRoster::snapshot() const {
+    return std::atomic_load_explicit(&state, std::memory_order_acquire);
+}
+
+uint64_t ConcurrentRoster::version() const {
+    return committed.load(std::memory_order_acquire);
+}
+
+bool ConcurrentRoster::update(const std::function<bool(Roster&)>& change) {
+    std::lock_guard<std::mutex> guard(writeLock);
+    auto next = std::make_shared<Roster>(*std::atomic_load_explicit(&state, std::memory_order_acquire));
+
+    // The copy records into a private journal; its entries reach the real one
+    // only once the change is published, so a change that edits and then
+    // fails journals nothing
+    RosterJournal* journal = next->getJournal();
+    RosterJournal staged;
+    if (journal != nullptr) {
+        next->setJournal(&staged);
+    }
+    bool changed = change(*next);
+    next->setJournal(journal);
+    if (!changed) {
+        return false;
+    }
+    std::atomic_store_explicit(&state, Snapshot(std::move(next)), std::memory_order_release);
+    committed.fetch_add(1, std::memory_order_release);
+    if (journal != nullptr) {
+        journal->takePending(staged);
+    }
+    return true;
+}
+
+void ConcurrentRoster::replace(Roster next) {
+    std::lock_guard<std::mutex> guard(writeLock);
+    std::atomic_store_explicit(&state, Snapshot(std::make_shared<const Roster>(std::move(next))),
+                               std::memory_order_release);
+    committed.fetch_add(1, std::memory_order_release);
+}
+
+bool ConcurrentRoster::commit() {
+    // Writers hand their entries to the journal under this lock, so holding it
+    // keeps the pending list and the snapshot it is written against in step
+    std::lock_guard<std::mutex> guard(writeLock);
+    Snapshot current = std::atomic_load_explicit(&state, std::memory_order_acquire);
+    RosterJournal* journal = current->getJournal();
+    return journal != nullptr && journal->commit(*current);
+}
+
+bool ConcurrentRoster::addPlayer(const Player& p) {
+    return update([&](Roster& roster) { return roster.addPlayer(p); });
+}
+
+bool ConcurrentRoster::removePlayer(int jerseyNumber) {
+    return update([&](Roster& roster) { return roster.removePlayer(jerseyNumber); });
+}
+
+bool ConcurrentRoster::editPlayer(int jerseyNumber, const Player& updatedPlayer) {
+    return update([&](Roster& roster) { return roster.editPlayer(jerseyNumber, updatedPlayer); });
+}
+
+void ConcurrentRoster::setTeamName(const std::string& name) {
+    update([&](Roster& roster) {
+        roster.setTeamName(name);
+        return true;
+    });
+}
@@ -0,0 +1,82 @@
+#ifndef CONCURRENTROSTER_H
+#define CONCURRENTROSTER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "Roster.h"
+
+// A Roster shared between many reader threads and any number of writers.
+//
+// Readers never block: snapshot() hands out an immutable Roster that stays
+// valid, and unchanged, for as long as the caller holds it. Writers are
+// serialized, copy the current roster, apply their change to the copy and
+// publish it as the new snapshot in one atomic step, so a reader sees
+// either all of a change or none of it. Every write copies the whole
+// roster, so a write costs O(players); that is small under the default cap,
+// but setPlayers, loads and League::toRoster can build larger rosters, and
+// several edits to one of those belong in a single update().
+//
+// The snapshot pointer is a std::shared_ptr read and written with
+// std::atomic_load/store. libstdc++ implements those with a small pool of
+// mutexes picked by address, so snapshot() takes a short lock rather than
+// being lock-free; Reader only calls it when the version has moved.
+//
+// RosterJournal has no lock of its own. Once a journaled roster is shared
+// here, persist it only through commit(), never through the journal or a
+// snapshot's getJournal() directly.
+class ConcurrentRoster {
+public:
+    using Snapshot = std::shared_ptr<const Roster>;
+
+    // Per-thread handle that only touches the shared snapshot when the
+    // version has moved, so steady-state reads write no shared memory
+    class Reader {
+    private:
+        const ConcurrentRoster* source;
+        Snapshot cached;
+        uint64_t cachedVersion;
+
+    public:
+        explicit Reader(const ConcurrentRoster& roster);
+        const Roster& current();
+    };
+
+private:
+    Snapshot state;                   // Only accessed through std::atomic_load/store
+    std::atomic<uint64_t> committed;  // Bumped after each publish
+    std::mutex writeLock;
+
+public:
+    explicit ConcurrentRoster(const std::string& name = "My Team");
+    explicit ConcurrentRoster(const Roster& initial);
+
+    ConcurrentRoster(const ConcurrentRoster&) = delete;
+    ConcurrentRoster& operator=(const ConcurrentRoster&) = delete;
+
+    Snapshot snapshot() const;
+    uint64_t version() const;
+
+    // Same rules as the Roster methods; nothing is published on failure
+    bool addPlayer(const Player& p);
+    bool removePlayer(int jerseyNumber);
+    bool editPlayer(int jerseyNumber, const Player& updatedPlayer);
+    void setTeamName(const std::string& name);
+
+    // Applies `change` to a private copy and publishes it if it returns true.
+    // Several edits made in one call become visible together, and reach an
+    // attached journal only then; `change` must not commit the journal itself.
+    bool update(const std::function<bool(Roster&)>& change);
+
+    // Publishes `next` as is, e.g. after loading a file
+    void replace(Roster next);
+
+    // Commits the attached journal against the current snapshot, serialized
+    // with writers; false if there is no journal or the write failed
+    bool commit();
+};
+
+#endif // CONCURRENTROSTER_H
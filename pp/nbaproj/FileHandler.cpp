@@ -1,7 +1,18 @@
 #include "FileHandler.h"
+#include "Journal.h"
+#include "MappedFile.h"
+#include "RosterParser.h"
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 std::vector<std::string> splitString(const std::string& input, char delimiter) {
     std::vector<std::string> result;
@@ -20,41 +31,134 @@ bool fileExists(const std::string& filename) {
     return file.good();
 }
 
-bool saveRoster(const Roster& roster, const std::string& filename) {
-    std::ofstream file(filename);
+void writePlayerRecord(std::ostream& out, const Player& p) {
+    out << p.firstName << ","
+        << p.lastName << ","
+        << p.jerseyNumber << ","
+        << p.position << ","
+        << p.heightInches << ","
+        << p.weightLbs << ","
+        << p.age << ","
+        << p.pointsPerGame << ","
+        << p.reboundsPerGame << ","
+        << p.assistsPerGame;
+}
+
+void writeRosterText(std::ostream& out, const Roster& roster) {
+    // Write team name
+    out << "TEAMNAME:" << roster.getTeamName() << "\n";
+    
+    // Write each player
+    for (const auto& player : roster.getPlayers()) {
+        out << "PLAYER:";
+        writePlayerRecord(out, player);
+        out << "\n";
+    }
+}
+
+bool syncFile(const std::string& filename) {
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+    bool synced = fsync(fd) == 0;
+    ::close(fd);
+    return synced;
+#else
+    (void)filename;
+    return true;
+#endif
+}
+
+bool writeFileAtomically(const std::string& filename,
+                         const std::function<void(std::ostream&)>& writer) {
+    std::string tempFile = filename + ".tmp";
+    std::ofstream file(tempFile, std::ios::binary | std::ios::trunc);
     
     if (!file.is_open()) {
         std::cerr << "  Error: Could not open file for writing.\n";
         return false;
     }
     
-    // Write team name
-    file << "TEAMNAME:" << roster.getTeamName() << "\n";
+    writer(file);
+    file.close();
+    if (file.fail() || !syncFile(tempFile)) {
+        std::remove(tempFile.c_str());
+        return false;
+    }
     
-    // Write each player
-    for (const auto& player : roster.getPlayers()) {
-        file << "PLAYER:"
-             << player.firstName << ","
-             << player.lastName << ","
-             << player.jerseyNumber << ","
-             << player.position << ","
-             << player.heightInches << ","
-             << player.weightLbs << ","
-             << player.age << ","
-             << player.pointsPerGame << ","
-             << player.reboundsPerGame << ","
-             << player.assistsPerGame << "\n";
+#ifdef _WIN32
+    // rename() does not replace an existing file on Windows
+    std::remove(filename.c_str());
+#endif
+    if (std::rename(tempFile.c_str(), filename.c_str()) != 0) {
+        std::remove(tempFile.c_str());
+        return false;
     }
     
-    file.close();
+    // Persist the rename itself
+    std::filesystem::path dir = std::filesystem::path(filename).parent_path();
+    syncFile(dir.empty() ? "." : dir.string());
     return true;
 }
 
+bool isSameFile(const std::string& a, const std::string& b) {
+    if (a == b) {
+        return true;
+    }
+    std::error_code errorA;
+    std::error_code errorB;
+    auto pathA = std::filesystem::weakly_canonical(a, errorA);
+    auto pathB = std::filesystem::weakly_canonical(b, errorB);
+    return !errorA && !errorB && pathA == pathB;
+}
+
+bool saveRoster(const Roster& roster, const std::string& filename) {
+    // Replacing the journal's snapshot behind its back would leave the journal
+    // to replay edits the new snapshot already holds
+    RosterJournal* journal = roster.getJournal();
+    if (journal != nullptr && isSameFile(filename, journal->getSnapshotFile())) {
+        return journal->checkpoint(roster);
+    }
+    return writeFileAtomically(filename, [&](std::ostream& out) { writeRosterText(out, roster); });
+}
+
 bool loadRoster(Roster& roster, const std::string& filename) {
     if (!fileExists(filename)) {
         return false;
     }
     
+    // Map the file and parse it in place, split across cores for large files
+    MappedFile file;
+    if (!file.open(filename)) {
+        std::cerr << "  Error: Could not open file for reading.\n";
+        return false;
+    }
+    
+    ParsedRoster parsed;
+    parseRosterTextParallel(file.view(), parsed);
+    file.close();
+    
+    if (parsed.skippedRecords > 0) {
+        std::cerr << "  Warning: " << parsed.skippedRecords << " invalid player record(s) skipped.\n";
+    }
+    
+    // Update roster
+    if (!parsed.teamName.empty()) {
+        roster.setTeamName(parsed.teamName);
+    }
+    roster.setPlayers(std::move(parsed.players));
+    roster.markSaved();
+    
+    return true;
+}
+
+bool loadRosterStream(Roster& roster, const std::string& filename) {
+    if (!fileExists(filename)) {
+        return false;
+    }
+    
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cerr << "  Error: Could not open file for reading.\n";
@@ -111,7 +215,7 @@ bool loadRoster(Roster& roster, const std::string& filename) {
     if (!teamName.empty()) {
         roster.setTeamName(teamName);
     }
-    roster.setPlayers(loadedPlayers);
+    roster.setPlayers(std::move(loadedPlayers));
     roster.markSaved();
     
     return true;
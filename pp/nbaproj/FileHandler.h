@@ -1,18 +1,29 @@
 #ifndef FILEHANDLER_H
 #define FILEHANDLER_H
 
+#include <functional>
+#include <ostream>
 #include <string>
 #include <vector>
 #include "Roster.h"
 
 const std::string DATA_FILE = "roster.txt";
 
-// File operations
+// File operations. saveRoster writes a temp file and renames it over the
+// old one, so a crash mid-save leaves the previous roster intact. Saving over
+// the snapshot of an attached journal checkpoints the journal instead.
 bool saveRoster(const Roster& roster, const std::string& filename = DATA_FILE);
 bool loadRoster(Roster& roster, const std::string& filename = DATA_FILE);
+bool loadRosterStream(Roster& roster, const std::string& filename = DATA_FILE);   // Line-by-line reference loader
 bool fileExists(const std::string& filename);
+bool isSameFile(const std::string& a, const std::string& b);   // Same path once resolved
 
 // Helper functions
 std::vector<std::string> splitString(const std::string& input, char delimiter);
+void writePlayerRecord(std::ostream& out, const Player& p);   // Fields after "PLAYER:"
+void writeRosterText(std::ostream& out, const Roster& roster);
+bool writeFileAtomically(const std::string& filename,
+                         const std::function<void(std::ostream&)>& writer);
+bool syncFile(const std::string& filename);   // Flush file contents to disk
 
 #endif // FILEHANDLER_H
@@ -0,0 +1,206 @@
+#include "FuzzyNameIndex.h"
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+
+namespace {
+
+std::string toLower(const std::string& str) {
+    std::string lower = str;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    return lower;
+}
+
+} // namespace
+
+int FuzzyNameIndex::levenshtein(const std::string& a, const std::string& b, int bound) {
+    // Two-row dynamic programming over the shorter string
+    const std::string& shorter = a.size() <= b.size() ? a : b;
+    const std::string& longer = a.size() <= b.size() ? b : a;
+    if (static_cast<int>(longer.size() - shorter.size()) > bound) {
+        return bound + 1;
+    }
+    
+    // Names fit on the stack; only unusually long input allocates
+    const size_t width = shorter.size() + 1;
+    int stackRows[2][64];
+    std::vector<int> heapRows;
+    int* prev = stackRows[0];
+    int* curr = stackRows[1];
+    if (width > 64) {
+        heapRows.resize(width * 2);
+        prev = heapRows.data();
+        curr = heapRows.data() + width;
+    }
+    
+    for (size_t j = 0; j < width; ++j) {
+        prev[j] = static_cast<int>(j);
+    }
+    for (size_t i = 1; i <= longer.size(); ++i) {
+        curr[0] = static_cast<int>(i);
+        int rowMin = curr[0];
+        for (size_t j = 1; j < width; ++j) {
+            int cost = longer[i - 1] == shorter[j - 1] ? 0 : 1;
+            curr[j] = std::min({prev[j] + 1, curr[j - 1] + 1, prev[j - 1] + cost});
+            rowMin = std::min(rowMin, curr[j]);
+        }
+        // Distances never shrink from one row to the next
+        if (rowMin > bound) {
+            return bound + 1;
+        }
+        std::swap(prev, curr);
+    }
+    return std::min(prev[width - 1], bound + 1);
+}
+
+int FuzzyNameIndex::defaultMaxDistance(const std::string& query) {
+    if (query.size() <= 4) return 1;
+    if (query.size() <= 10) return 2;
+    return 3;
+}
+
+uint32_t FuzzyNameIndex::BkTree::add(const std::string& term) {
+    auto found = nodeOf.find(term);
+    if (found != nodeOf.end()) {
+        return found->second;
+    }
+    uint32_t id = static_cast<uint32_t>(nodes.size());
+    nodes.push_back(Node{term, {}, {}, 0});
+    nodeOf.emplace(term, id);
+    if (id == 0) {
+        return id;
+    }
+    
+    // Walk down edges of equal distance until there is no such child
+    uint32_t current = 0;
+    while (true) {
+        int d = levenshtein(term, nodes[current].term, INT_MAX - 1);
+        std::vector<std::pair<int, uint32_t>>& children = nodes[current].children;
+        auto child = std::find_if(children.begin(), children.end(),
+                                  [d](const std::pair<int, uint32_t>& c) { return c.first == d; });
+        if (child == children.end()) {
+            children.emplace_back(d, id);
+            nodes[current].maxEdge = std::max(nodes[current].maxEdge, d);
+            return id;
+        }
+        current = child->second;
+    }
+}
+
+void FuzzyNameIndex::BkTree::search(const std::string& query, int maxDistance,
+                                    std::unordered_map<uint32_t, int>& best) const {
+    if (nodes.empty()) {
+        return;
+    }
+    std::vector<uint32_t> pending{0};
+    while (!pending.empty()) {
+        const Node& node = nodes[pending.back()];
+        pending.pop_back();
+        
+        // Past maxEdge + maxDistance no child can qualify, so the exact value is not needed
+        int d = levenshtein(query, node.term, node.maxEdge + maxDistance);
+        if (d <= maxDistance) {
+            for (uint32_t id : node.ids) {
+                auto it = best.find(id);
+                if (it == best.end() || d < it->second) {
+                    best[id] = d;
+                }
+            }
+        }
+        // Triangle inequality: only children within maxDistance of d can match
+        for (const auto& child : node.children) {
+            if (std::abs(child.first - d) <= maxDistance) {
+                pending.push_back(child.second);
+            }
+        }
+    }
+}
+
+void FuzzyNameIndex::BkTree::clear() {
+    nodes.clear();
+    nodeOf.clear();
+}
+
+void FuzzyNameIndex::insert(uint32_t id, const std::string& firstName, const std::string& lastName) {
+    if (id < present.size() && present[id]) {
+        remove(id);
+    }
+    if (id >= present.size()) {
+        present.resize(id + 1, false);
+        nodesOf.resize(id + 1, {NO_NODE, NO_NODE});
+    }
+    
+    std::array<uint32_t, 2> added = {words.add(toLower(firstName)), words.add(toLower(lastName))};
+    words.nodes[added[0]].ids.push_back(id);
+    if (added[1] != added[0]) {
+        words.nodes[added[1]].ids.push_back(id);
+    }
+    nodesOf[id] = added;
+    present[id] = true;
+}
+
+void FuzzyNameIndex::remove(uint32_t id) {
+    if (id >= present.size() || !present[id]) {
+        return;
+    }
+    // Nodes stay in the tree as routing points even when no id uses them
+    for (uint32_t node : nodesOf[id]) {
+        std::vector<uint32_t>& ids = words.nodes[node].ids;
+        ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+    }
+    nodesOf[id] = {NO_NODE, NO_NODE};
+    present[id] = false;
+}
+
+void FuzzyNameIndex::clear() {
+    words.clear();
+    nodesOf.clear();
+    present.clear();
+}
+
+std::vector<FuzzyMatch> FuzzyNameIndex::search(const std::string& query, int maxDistance,
+                                               size_t limit) const {
+    std::string lower = toLower(query);
+    size_t begin = lower.find_first_not_of(' ');
+    if (begin == std::string::npos) {
+        return {};
+    }
+    lower = lower.substr(begin, lower.find_last_not_of(' ') + 1 - begin);
+    std::unordered_map<uint32_t, int> best;
+    
+    size_t space = lower.find(' ');
+    if (space == std::string::npos) {
+        words.search(lower, maxDistance, best);
+    } else {
+        // Each half is within maxDistance whenever the sum is, so search the
+        // first word and score the survivors on both names
+        std::string first = lower.substr(0, space);
+        std::string last = lower.substr(lower.find_first_not_of(' ', space));
+        std::unordered_map<uint32_t, int> firstMatches;
+        words.search(first, maxDistance, firstMatches);
+        for (const auto& entry : firstMatches) {
+            const std::array<uint32_t, 2>& nodes = nodesOf[entry.first];
+            int firstDistance = levenshtein(first, words.nodes[nodes[0]].term, maxDistance);
+            if (firstDistance > maxDistance) continue;
+            int lastDistance = levenshtein(last, words.nodes[nodes[1]].term,
+                                           maxDistance - firstDistance);
+            if (firstDistance + lastDistance <= maxDistance) {
+                best[entry.first] = firstDistance + lastDistance;
+            }
+        }
+    }
+    
+    std::vector<FuzzyMatch> matches;
+    matches.reserve(best.size());
+    for (const auto& entry : best) {
+        matches.push_back(FuzzyMatch{entry.first, entry.second});
+    }
+    auto closer = [](const FuzzyMatch& a, const FuzzyMatch& b) {
+        return a.distance != b.distance ? a.distance < b.distance : a.id < b.id;
+    };
+    size_t keep = std::min(limit, matches.size());
+    std::partial_sort(matches.begin(), matches.begin() + keep, matches.end(), closer);
+    matches.resize(keep);
+    return matches;
+}
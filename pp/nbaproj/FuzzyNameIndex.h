@@ -0,0 +1,59 @@
+#ifndef FUZZYNAMEINDEX_H
+#define FUZZYNAMEINDEX_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+struct FuzzyMatch {
+    uint32_t id;
+    int distance;   // Edit distance to the closest of the player's names
+};
+
+// Typo-tolerant name lookup. Lowercase first and last names are kept in a
+// BK-tree, so a search only computes edit distances for the branches that
+// can still be within range. A multi-word query matches its first word
+// against first names and the rest against last names.
+class FuzzyNameIndex {
+private:
+    // Metric tree over distinct terms; children are keyed by their distance to the parent
+    struct BkTree {
+        struct Node {
+            std::string term;
+            std::vector<uint32_t> ids;
+            std::vector<std::pair<int, uint32_t>> children;
+            int maxEdge;
+        };
+        std::vector<Node> nodes;
+        std::unordered_map<std::string, uint32_t> nodeOf;
+
+        uint32_t add(const std::string& term);
+        void search(const std::string& query, int maxDistance,
+                    std::unordered_map<uint32_t, int>& best) const;
+        void clear();
+    };
+
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+    BkTree words;   // First and last names
+    std::vector<std::array<uint32_t, 2>> nodesOf;   // By id: first and last name nodes
+    std::vector<bool> present;
+
+public:
+    void insert(uint32_t id, const std::string& firstName, const std::string& lastName);
+    void remove(uint32_t id);
+    void clear();
+
+    // Up to `limit` ids within `maxDistance` edits of the query, closest
+    // first, ties by ascending id. For a full name the edits are summed.
+    std::vector<FuzzyMatch> search(const std::string& query, int maxDistance, size_t limit) const;
+
+    // Edit distance, or bound + 1 as soon as it is known to exceed bound
+    static int levenshtein(const std::string& a, const std::string& b, int bound);
+    static int defaultMaxDistance(const std::string& query);   // Scales with query length
+};
+
+#endif // FUZZYNAMEINDEX_H
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <algorithm>
 #include <cctype>
+#include <charconv>
 #include <sstream>
 #include <limits>
 
@@ -10,22 +11,88 @@ const std::vector<std::string> VALID_POSITIONS = {"PG", "SG", "SF", "PF", "C"};
 const int MIN_JERSEY = 0;
 const int MAX_JERSEY = 99;
 const int MAX_ROSTER_SIZE = 15;
+const int MIN_HEIGHT = 60;
+const int MAX_HEIGHT = 96;
+const int MIN_WEIGHT = 150;
+const int MAX_WEIGHT = 350;
+const int MIN_AGE = 18;
+const int MAX_AGE = 45;
+const double MAX_PPG = 50.0;
+const double MAX_RPG = 25.0;
+const double MAX_APG = 20.0;
 
-std::string trim(const std::string& str) {
-    size_t start = str.find_first_not_of(" \t\n\r");
-    if (start == std::string::npos) return "";
-    size_t end = str.find_last_not_of(" \t\n\r");
+namespace {
+
+const std::string_view WHITESPACE = " \t\n\r";
+
+// Same comparison as toUpperCase(str) == upper, without the copy
+bool equalsUpper(std::string_view str, std::string_view upper) {
+    if (str.size() != upper.size()) return false;
+    for (size_t i = 0; i < str.size(); ++i) {
+        if (::toupper(str[i]) != upper[i]) return false;
+    }
+    return true;
+}
+
+// strtod reports ERANGE for a value that would round below DBL_MIN with an
+// unbounded exponent: anything under the midpoint between DBL_MIN and the
+// double before it, (2^54 - 1) * 2^-1076. Written out exactly, that is 307
+// zeros after the point and then these digits, the digits of
+// (2^54 - 1) * 5^1076.
+const size_t UNDERFLOW_LEADING_ZEROS = 307;
+const std::string_view UNDERFLOW_DIGITS =
+    "2225073858507201259573821257020768020077017763406988739288376763"
+    "3060133284174975706854063414603230542391082493220377160560112603"
+    "0012402737719183479639276972143707899083653279890443184986473250"
+    "4110467273084696977812028716236556967935895657351868202788722494"
+    "8115301513176163663332969459534313692221903080537876949404117437"
+    "0780982258074098888055161790711900214875940191589215148208192489"
+    "0263312702257321184750771861452224096212631698623638776860141838"
+    "0611657022637766409076481944355360543363737279780145931006786604"
+    "9211751678490852151115976737332333919198322132685351912833878489"
+    "1913380715532840971003878993627240686726663397609149834349831344"
+    "8796766534690915591301898991145211247823805473410097755906760962"
+    "9158594969774301893081138586927281153293733950704336166381835937"
+    "5";
+
+// Whether "0.<fraction>" is below that bound, compared digit by digit, so
+// no terminated copy of the input is needed to ask strtod
+bool fractionUnderflows(std::string_view fraction) {
+    size_t length = std::max(fraction.size(), UNDERFLOW_LEADING_ZEROS + UNDERFLOW_DIGITS.size());
+    for (size_t i = 0; i < length; ++i) {
+        char digit = i < fraction.size() ? fraction[i] : '0';
+        char bound = '0';
+        if (i >= UNDERFLOW_LEADING_ZEROS && i - UNDERFLOW_LEADING_ZEROS < UNDERFLOW_DIGITS.size()) {
+            bound = UNDERFLOW_DIGITS[i - UNDERFLOW_LEADING_ZEROS];
+        }
+        if (digit != bound) {
+            return digit < bound;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+std::string_view trimView(std::string_view str) {
+    size_t start = str.find_first_not_of(WHITESPACE);
+    if (start == std::string_view::npos) return std::string_view();
+    size_t end = str.find_last_not_of(WHITESPACE);
     return str.substr(start, end - start + 1);
 }
 
+std::string trim(const std::string& str) {
+    return std::string(trimView(str));
+}
+
 std::string toUpperCase(const std::string& str) {
     std::string result = str;
     std::transform(result.begin(), result.end(), result.begin(), ::toupper);
     return result;
 }
 
-std::string capitalize(const std::string& str) {
-    std::string result = str;
+void capitalizeInto(std::string_view str, std::string& result) {
+    result.assign(str.data(), str.size());
     bool newWord = true;
     for (size_t i = 0; i < result.length(); ++i) {
         if (newWord && std::isalpha(result[i])) {
@@ -37,10 +104,15 @@ std::string capitalize(const std::string& str) {
             result[i] = std::tolower(result[i]);
         }
     }
+}
+
+std::string capitalize(const std::string& str) {
+    std::string result;
+    capitalizeInto(str, result);
     return result;
 }
 
-bool isNumeric(const std::string& str) {
+bool isNumeric(std::string_view str) {
     if (str.empty()) return false;
     for (char c : str) {
         if (!std::isdigit(c)) return false;
@@ -48,7 +120,7 @@ bool isNumeric(const std::string& str) {
     return true;
 }
 
-bool isAlphaOrSpecial(const std::string& str) {
+bool isAlphaOrSpecial(std::string_view str) {
     if (str.empty()) return false;
     for (char c : str) {
         if (!std::isalpha(c) && c != ' ' && c != '-' && c != '\'') {
@@ -58,24 +130,28 @@ bool isAlphaOrSpecial(const std::string& str) {
     return true;
 }
 
-bool validateJerseyNumber(const std::string& input, int& result) {
-    std::string trimmed = trim(input);
-    if (!isNumeric(trimmed)) return false;
-    
-    try {
-        int num = std::stoi(trimmed);
-        if (num < MIN_JERSEY || num > MAX_JERSEY) return false;
-        result = num;
-        return true;
-    } catch (...) {
-        return false;
+int positionIndex(const std::string& pos) {
+    for (size_t i = 0; i < VALID_POSITIONS.size(); ++i) {
+        if (VALID_POSITIONS[i] == pos) {
+            return static_cast<int>(i);
+        }
     }
+    return -1;
 }
 
-bool validatePosition(const std::string& input, std::string& result) {
-    std::string upper = toUpperCase(trim(input));
+int positionIndex(const InternedString& pos) {
+    uint32_t index = pos.getId() - InternedString::FIRST_POSITION_ID;
+    return index < VALID_POSITIONS.size() ? static_cast<int>(index) : -1;
+}
+
+bool checkJerseyNumber(std::string_view input, int& result) {
+    return checkPositiveInt(input, result, MIN_JERSEY, MAX_JERSEY);
+}
+
+bool checkPosition(std::string_view input, std::string_view& result) {
+    std::string_view trimmed = trimView(input);
     for (const auto& pos : VALID_POSITIONS) {
-        if (upper == pos) {
+        if (equalsUpper(trimmed, pos)) {
             result = pos;
             return true;
         }
@@ -83,30 +159,38 @@ bool validatePosition(const std::string& input, std::string& result) {
     return false;
 }
 
-bool validateName(const std::string& input, std::string& result) {
-    std::string trimmed = trim(input);
-    if (trimmed.empty()) return false;
-    if (!isAlphaOrSpecial(trimmed)) return false;
-    result = capitalize(trimmed);
+bool checkName(std::string_view input, std::string_view& trimmed) {
+    std::string_view name = trimView(input);
+    if (!isAlphaOrSpecial(name)) return false;
+    trimmed = name;
     return true;
 }
 
-bool validatePositiveInt(const std::string& input, int& result, int min, int max) {
-    std::string trimmed = trim(input);
+bool checkTeamName(std::string_view input, std::string_view& trimmed) {
+    std::string_view name = trimView(input);
+    if (name.empty()) return false;
+    for (char c : name) {
+        if (std::iscntrl(static_cast<unsigned char>(c))) return false;
+    }
+    trimmed = name;
+    return true;
+}
+
+bool checkPositiveInt(std::string_view input, int& result, int min, int max) {
+    std::string_view trimmed = trimView(input);
     if (!isNumeric(trimmed)) return false;
     
-    try {
-        int num = std::stoi(trimmed);
-        if (num < min || num > max) return false;
-        result = num;
-        return true;
-    } catch (...) {
-        return false;
-    }
+    // Digits only, so from_chars fails exactly where stoi would throw: on overflow
+    int num;
+    auto parsed = std::from_chars(trimmed.data(), trimmed.data() + trimmed.size(), num);
+    if (parsed.ec != std::errc()) return false;
+    if (num < min || num > max) return false;
+    result = num;
+    return true;
 }
 
-bool validatePositiveDouble(const std::string& input, double& result, double min, double max) {
-    std::string trimmed = trim(input);
+bool checkPositiveDouble(std::string_view input, double& result, double min, double max) {
+    std::string_view trimmed = trimView(input);
     if (trimmed.empty()) return false;
     
     bool hasDot = false;
@@ -119,29 +203,76 @@ bool validatePositiveDouble(const std::string& input, double& result, double min
         }
     }
     
-    try {
-        double num = std::stod(trimmed);
-        if (num < min || num > max) return false;
-        result = num;
-        return true;
-    } catch (...) {
+    // A lone "." and overflow fail here, as stod would throw
+    double num;
+    auto parsed = std::from_chars(trimmed.data(), trimmed.data() + trimmed.size(), num);
+    if (parsed.ec != std::errc() || parsed.ptr != trimmed.data() + trimmed.size()) return false;
+    // stod also throws on underflow: nonzero digits that come out subnormal or zero
+    if (num < std::numeric_limits<double>::min() &&
+        trimmed.find_first_not_of("0.") != std::string_view::npos) {
         return false;
     }
+    // A value just below DBL_MIN can round up to it and still count as
+    // underflow to stod. Such a value is "0." plus a fraction.
+    if (num == std::numeric_limits<double>::min()) {
+        size_t dot = trimmed.find('.');
+        if (fractionUnderflows(trimmed.substr(dot + 1))) return false;
+    }
+    if (num < min || num > max) return false;
+    result = num;
+    return true;
 }
 
-bool validateYesNo(const std::string& input, bool& result) {
-    std::string upper = toUpperCase(trim(input));
-    if (upper == "Y" || upper == "YES") {
+bool checkYesNo(std::string_view input, bool& result) {
+    std::string_view trimmed = trimView(input);
+    if (equalsUpper(trimmed, "Y") || equalsUpper(trimmed, "YES")) {
         result = true;
         return true;
     }
-    if (upper == "N" || upper == "NO") {
+    if (equalsUpper(trimmed, "N") || equalsUpper(trimmed, "NO")) {
         result = false;
         return true;
     }
     return false;
 }
 
+bool validateJerseyNumber(const std::string& input, int& result) {
+    return checkJerseyNumber(input, result);
+}
+
+bool validatePosition(const std::string& input, std::string& result) {
+    std::string_view pos;
+    if (!checkPosition(input, pos)) return false;
+    result.assign(pos.data(), pos.size());
+    return true;
+}
+
+bool validateName(const std::string& input, std::string& result) {
+    std::string_view trimmed;
+    if (!checkName(input, trimmed)) return false;
+    capitalizeInto(trimmed, result);
+    return true;
+}
+
+bool validateTeamName(const std::string& input, std::string& result) {
+    std::string_view trimmed;
+    if (!checkTeamName(input, trimmed)) return false;
+    result.assign(trimmed.data(), trimmed.size());
+    return true;
+}
+
+bool validatePositiveInt(const std::string& input, int& result, int min, int max) {
+    return checkPositiveInt(input, result, min, max);
+}
+
+bool validatePositiveDouble(const std::string& input, double& result, double min, double max) {
+    return checkPositiveDouble(input, result, min, max);
+}
+
+bool validateYesNo(const std::string& input, bool& result) {
+    return checkYesNo(input, result);
+}
+
 int getMenuChoice(int min, int max) {
     std::string input;
     int result;
@@ -204,6 +335,19 @@ std::string getValidatedName(const std::string& prompt) {
     }
 }
 
+std::string getValidatedTeamName(const std::string& prompt) {
+    std::string input;
+    std::string result;
+    while (true) {
+        std::cout << prompt;
+        std::getline(std::cin, input);
+        if (validateTeamName(input, result)) {
+            return result;
+        }
+        std::cout << "  Invalid team name. Enter at least one visible character.\n";
+    }
+}
+
 int getValidatedJersey(const std::string& prompt) {
     std::string input;
     int result;
@@ -2,22 +2,43 @@
 #define INPUTVALIDATOR_H
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include "InternedString.h"
 
 // Validation functions
 bool validateJerseyNumber(const std::string& input, int& result);
 bool validatePosition(const std::string& input, std::string& result);
 bool validateName(const std::string& input, std::string& result);
+bool validateTeamName(const std::string& input, std::string& result);   // Trimmed, as typed
 bool validatePositiveInt(const std::string& input, int& result, int min, int max);
 bool validatePositiveDouble(const std::string& input, double& result, double min, double max);
 bool validateYesNo(const std::string& input, bool& result);
 
+// Allocation-free forms of the validators above, for bulk imports. They accept
+// and reject exactly the same input, never throw, and leave `result` alone on
+// failure. checkPosition points `result` at the VALID_POSITIONS entry; checkName
+// only validates, and capitalizeInto writes the stored form into a reused string.
+bool checkJerseyNumber(std::string_view input, int& result);
+bool checkPosition(std::string_view input, std::string_view& result);
+bool checkName(std::string_view input, std::string_view& trimmed);
+// Team names are free text, as the roster files allow: anything non-empty
+// once trimmed, without control characters such as a line break
+bool checkTeamName(std::string_view input, std::string_view& trimmed);
+bool checkPositiveInt(std::string_view input, int& result, int min, int max);
+bool checkPositiveDouble(std::string_view input, double& result, double min, double max);
+bool checkYesNo(std::string_view input, bool& result);
+void capitalizeInto(std::string_view str, std::string& result);
+
 // Utility functions
 std::string trim(const std::string& str);
+std::string_view trimView(std::string_view str);
 std::string toUpperCase(const std::string& str);
 std::string capitalize(const std::string& str);
-bool isNumeric(const std::string& str);
-bool isAlphaOrSpecial(const std::string& str);
+bool isNumeric(std::string_view str);
+bool isAlphaOrSpecial(std::string_view str);
+int positionIndex(const std::string& pos);   // Index into VALID_POSITIONS, or -1
+int positionIndex(const InternedString& pos);   // Same, read off the pinned id
 
 // Generic input getter
 int getMenuChoice(int min, int max);
@@ -25,6 +46,7 @@ std::string getStringInput(const std::string& prompt);
 int getValidatedInt(const std::string& prompt, int min, int max);
 double getValidatedDouble(const std::string& prompt, double min, double max);
 std::string getValidatedName(const std::string& prompt);
+std::string getValidatedTeamName(const std::string& prompt);
 int getValidatedJersey(const std::string& prompt);
 std::string getValidatedPosition(const std::string& prompt);
 bool getYesNo(const std::string& prompt);
@@ -35,4 +57,15 @@ extern const int MIN_JERSEY;
 extern const int MAX_JERSEY;
 extern const int MAX_ROSTER_SIZE;
 
+// Ranges the add/edit prompts and the importer enforce
+extern const int MIN_HEIGHT;
+extern const int MAX_HEIGHT;
+extern const int MIN_WEIGHT;
+extern const int MAX_WEIGHT;
+extern const int MIN_AGE;
+extern const int MAX_AGE;
+extern const double MAX_PPG;
+extern const double MAX_RPG;
+extern const double MAX_APG;
+
 #endif // INPUTVALIDATOR_H
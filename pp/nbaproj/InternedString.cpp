@@ -0,0 +1,191 @@
+#include "InternedString.h"
+#include "InputValidator.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct Slot {
+    std::string text;
+    std::atomic<uint32_t> refs{0};
+};
+
+// One lock's worth of the pool. Slots live in chunks that double in size
+// and never move, so readers can look an id up without the lock; a slot is
+// only rewritten once nothing refers to it.
+struct alignas(64) Shard {
+    static constexpr uint32_t BASE_BITS = 6;
+    static constexpr uint32_t MAX_CHUNKS = 21;  // Room for every local index an id can hold
+
+    std::mutex lock;
+    std::unordered_map<std::string_view, uint32_t> locals;
+    std::vector<uint32_t> freeSlots;
+    uint32_t next = 1;  // Local index 0 belongs to the pinned strings
+    std::unique_ptr<Slot[]> chunks[MAX_CHUNKS];
+
+    // Chunk k holds local indexes [(2^k - 1) << BASE_BITS, (2^(k+1) - 1) << BASE_BITS)
+    static uint32_t chunkOf(uint32_t local, uint32_t& offset) {
+        uint32_t v = (local >> BASE_BITS) + 1;
+#if defined(__GNUC__)
+        uint32_t k = 31 - static_cast<uint32_t>(__builtin_clz(v));
+#else
+        uint32_t k = 0;
+        while (v >> (k + 1)) {
+            ++k;
+        }
+#endif
+        offset = local - (((1u << k) - 1) << BASE_BITS);
+        return k;
+    }
+
+    Slot& slot(uint32_t local) const {
+        uint32_t offset;
+        uint32_t k = chunkOf(local, offset);
+        return chunks[k][offset];
+    }
+};
+
+class GlobalPool {
+private:
+    static constexpr uint32_t SHARDS = InternedString::SHARD_COUNT;
+    static constexpr uint32_t MAX_LOCAL = UINT32_MAX / SHARDS;
+
+    std::vector<std::string> pinned;  // "" then VALID_POSITIONS, by id
+    size_t longestPinned;
+    Shard shards[SHARDS];
+
+    uint32_t findPinned(std::string_view str) const {
+        if (str.size() <= longestPinned) {
+            for (uint32_t i = 0; i < pinned.size(); ++i) {
+                if (str == pinned[i]) {
+                    return i;
+                }
+            }
+        }
+        return SHARDS;
+    }
+
+    // Caller holds shard.lock
+    uint32_t allocate(Shard& shard) {
+        if (!shard.freeSlots.empty()) {
+            uint32_t local = shard.freeSlots.back();
+            shard.freeSlots.pop_back();
+            return local;
+        }
+        if (shard.next > MAX_LOCAL) {
+            throw std::length_error("string pool is full");
+        }
+        uint32_t local = shard.next++;
+        uint32_t offset;
+        uint32_t k = Shard::chunkOf(local, offset);
+        if (!shard.chunks[k]) {
+            shard.chunks[k].reset(new Slot[(1u << k) << Shard::BASE_BITS]);
+        }
+        return local;
+    }
+
+public:
+    GlobalPool() : pinned(1), longestPinned(0) {
+        pinned.insert(pinned.end(), VALID_POSITIONS.begin(), VALID_POSITIONS.end());
+        for (const auto& pos : VALID_POSITIONS) {
+            longestPinned = std::max(longestPinned, pos.size());
+        }
+    }
+
+    uint32_t intern(std::string_view str) {
+        // Empty strings and positions skip the lock entirely
+        uint32_t id = findPinned(str);
+        if (id < SHARDS) {
+            return id;
+        }
+        uint32_t index = static_cast<uint32_t>(std::hash<std::string_view>()(str) % SHARDS);
+        Shard& shard = shards[index];
+        std::lock_guard<std::mutex> guard(shard.lock);
+        auto it = shard.locals.find(str);
+        if (it != shard.locals.end()) {
+            shard.slot(it->second).refs.fetch_add(1, std::memory_order_relaxed);
+            return it->second * SHARDS + index;
+        }
+        uint32_t local = allocate(shard);
+        Slot& slot = shard.slot(local);
+        slot.text.assign(str.data(), str.size());
+        slot.refs.store(1, std::memory_order_relaxed);
+        shard.locals.emplace(slot.text, local);
+        return local * SHARDS + index;
+    }
+
+    void retain(uint32_t id) {
+        shards[id % SHARDS].slot(id / SHARDS).refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release(uint32_t id) {
+        Shard& shard = shards[id % SHARDS];
+        uint32_t local = id / SHARDS;
+        Slot& slot = shard.slot(local);
+        // Dropping a reference that is not the last needs no lock
+        uint32_t refs = slot.refs.load(std::memory_order_relaxed);
+        while (refs > 1) {
+            if (slot.refs.compare_exchange_weak(refs, refs - 1, std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+                return;
+            }
+        }
+        // The last one is dropped under the lock so intern cannot revive it halfway
+        std::lock_guard<std::mutex> guard(shard.lock);
+        if (slot.refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            shard.locals.erase(std::string_view(slot.text));
+            std::string().swap(slot.text);
+            shard.freeSlots.push_back(local);
+        }
+    }
+
+    const std::string& get(uint32_t id) const {
+        if (id < SHARDS) {
+            return pinned[id];
+        }
+        return shards[id % SHARDS].slot(id / SHARDS).text;
+    }
+
+    size_t size() {
+        size_t count = pinned.size();
+        for (Shard& shard : shards) {
+            std::lock_guard<std::mutex> guard(shard.lock);
+            count += shard.locals.size();
+        }
+        return count;
+    }
+};
+
+// Never destroyed, so an InternedString outliving static destruction stays safe
+GlobalPool& pool() {
+    static GlobalPool* instance = new GlobalPool();
+    return *instance;
+}
+
+} // namespace
+
+uint32_t InternedString::intern(std::string_view str) {
+    return pool().intern(str);
+}
+
+void InternedString::retain(uint32_t id) {
+    pool().retain(id);
+}
+
+void InternedString::release(uint32_t id) {
+    pool().release(id);
+}
+
+const std::string& InternedString::str() const {
+    return pool().get(id);
+}
+
+size_t InternedString::poolSize() {
+    return pool().size();
+}
@@ -0,0 +1,101 @@
+#ifndef INTERNEDSTRING_H
+#define INTERNEDSTRING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+// A string stored once in a process-wide pool and referred to by a 32-bit
+// id. Equal strings share an id, so equality is an integer compare and a
+// copy only bumps a reference count. A pooled string is freed when its last
+// InternedString goes away, so reloading a roster releases the old names.
+//
+// The pool is split into shards by hash, each with its own lock, so
+// parser threads interning different names rarely wait on each other.
+// Id 0 is the empty string and ids 1..VALID_POSITIONS.size() are pinned to
+// the positions in order, so a player's position doubles as a position
+// code; neither is counted or ever freed.
+class InternedString {
+public:
+    static constexpr uint32_t SHARD_COUNT = 64;   // Ids below this are pinned
+    static constexpr uint32_t FIRST_POSITION_ID = 1;
+
+private:
+    uint32_t id;
+
+    static uint32_t intern(std::string_view str);
+    static void retain(uint32_t id);
+    static void release(uint32_t id);
+
+public:
+    InternedString() : id(0) {}
+    InternedString(const std::string& str) : id(intern(str)) {}
+    InternedString(const char* str) : id(intern(str)) {}
+    explicit InternedString(std::string_view str) : id(intern(str)) {}
+
+    InternedString(const InternedString& other) : id(other.id) {
+        if (id >= SHARD_COUNT) {
+            retain(id);
+        }
+    }
+    InternedString(InternedString&& other) noexcept : id(other.id) { other.id = 0; }
+    ~InternedString() {
+        if (id >= SHARD_COUNT) {
+            release(id);
+        }
+    }
+
+    InternedString& operator=(const InternedString& other) {
+        if (other.id >= SHARD_COUNT) {
+            retain(other.id);
+        }
+        if (id >= SHARD_COUNT) {
+            release(id);
+        }
+        id = other.id;
+        return *this;
+    }
+    InternedString& operator=(InternedString&& other) noexcept {
+        if (this != &other) {
+            if (id >= SHARD_COUNT) {
+                release(id);
+            }
+            id = other.id;
+            other.id = 0;
+        }
+        return *this;
+    }
+
+    const std::string& str() const;
+    operator const std::string&() const { return str(); }
+    uint32_t getId() const { return id; }
+
+    size_t size() const { return str().size(); }
+    bool empty() const { return id == 0; }
+    const char* data() const { return str().data(); }
+    const char* c_str() const { return str().c_str(); }
+
+    static size_t poolSize();   // Distinct strings pooled right now, pinned ones included
+};
+
+inline bool operator==(const InternedString& a, const InternedString& b) { return a.getId() == b.getId(); }
+inline bool operator!=(const InternedString& a, const InternedString& b) { return a.getId() != b.getId(); }
+inline bool operator==(const InternedString& a, const std::string& b) { return a.str() == b; }
+inline bool operator!=(const InternedString& a, const std::string& b) { return a.str() != b; }
+inline bool operator==(const std::string& a, const InternedString& b) { return a == b.str(); }
+inline bool operator!=(const std::string& a, const InternedString& b) { return a != b.str(); }
+inline bool operator==(const InternedString& a, const char* b) { return a.str() == b; }
+inline bool operator!=(const InternedString& a, const char* b) { return a.str() != b; }
+
+inline std::string operator+(const InternedString& a, const InternedString& b) { return a.str() + b.str(); }
+inline std::string operator+(const InternedString& a, const std::string& b) { return a.str() + b; }
+inline std::string operator+(const InternedString& a, const char* b) { return a.str() + b; }
+inline std::string operator+(const std::string& a, const InternedString& b) { return a + b.str(); }
+inline std::string operator+(std::string&& a, const InternedString& b) { return std::move(a += b.str()); }
+inline std::string operator+(const char* a, const InternedString& b) { return a + b.str(); }
+
+inline std::ostream& operator<<(std::ostream& out, const InternedString& str) { return out << str.str(); }
+
+#endif // INTERNEDSTRING_H
@@ -0,0 +1,277 @@
+#include "Journal.h"
+#include "MappedFile.h"
+#include "Roster.h"
+#include "RosterParser.h"
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const std::string_view SEQUENCE_PREFIX = "JOURNALSEQ:";
+const std::string_view COMMIT_PREFIX = "COMMIT:";
+
+bool startsWith(std::string_view text, std::string_view prefix) {
+    return text.substr(0, prefix.size()) == prefix;
+}
+
+bool parseSequence(std::string_view text, unsigned long long& result) {
+    auto parsed = std::from_chars(text.data(), text.data() + text.size(), result);
+    return parsed.ec == std::errc() && parsed.ptr == text.data() + text.size();
+}
+
+// Applies one "OP:args" entry; false if it is malformed or the roster refuses it
+bool applyEntry(Roster& roster, std::string_view op) {
+    if (startsWith(op, "ADD:")) {
+        Player p;
+        return parsePlayerRecord(op.substr(4), p) && roster.addPlayer(p);
+    }
+    if (startsWith(op, "REMOVE:")) {
+        int jersey;
+        return parseIntField(op.substr(7), jersey) && roster.removePlayer(jersey);
+    }
+    if (startsWith(op, "EDIT:")) {
+        op.remove_prefix(5);
+        size_t colon = op.find(':');
+        int jersey;
+        Player p;
+        return colon != std::string_view::npos && parseIntField(op.substr(0, colon), jersey) &&
+               parsePlayerRecord(op.substr(colon + 1), p) && roster.editPlayer(jersey, p);
+    }
+    if (startsWith(op, "TEAM:")) {
+        roster.setTeamName(std::string(op.substr(5)));
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+RosterJournal::RosterJournal(const std::string& journal, const std::string& snapshot,
+                             size_t compactThreshold)
+    : journalFile(journal), snapshotFile(snapshot), nextSequence(1),
+      journaledEntries(0), compactEvery(compactThreshold) {}
+
+void RosterJournal::record(const std::string& entry) {
+    pending.push_back(std::to_string(nextSequence++) + ":" + entry);
+}
+
+void RosterJournal::recordAdd(const Player& p) {
+    std::ostringstream oss;
+    oss << "ADD:";
+    writePlayerRecord(oss, p);
+    record(oss.str());
+}
+
+void RosterJournal::recordRemove(int jerseyNumber) {
+    record("REMOVE:" + std::to_string(jerseyNumber));
+}
+
+void RosterJournal::recordEdit(int jerseyNumber, const Player& p) {
+    std::ostringstream oss;
+    oss << "EDIT:" << jerseyNumber << ":";
+    writePlayerRecord(oss, p);
+    record(oss.str());
+}
+
+void RosterJournal::recordTeamName(const std::string& name) {
+    record("TEAM:" + name);
+}
+
+void RosterJournal::takePending(RosterJournal& staged) {
+    for (const auto& entry : staged.pending) {
+        record(entry.substr(entry.find(':') + 1));
+    }
+    staged.pending.clear();
+}
+
+bool RosterJournal::commit(const Roster& roster) {
+    // The snapshot includes the pending entries, so they need not be appended first
+    if (journaledEntries + pending.size() >= compactEvery) {
+        if (!compact(roster)) {
+            return false;
+        }
+        pending.clear();
+        return true;
+    }
+    if (pending.empty()) {
+        return true;
+    }
+
+    std::ofstream file(journalFile, std::ios::binary | std::ios::app);
+    if (!file.is_open()) {
+        std::cerr << "  Error: Could not open journal for writing.\n";
+        return false;
+    }
+    for (const auto& entry : pending) {
+        file << entry << "\n";
+    }
+    // Closes the group; recovery replays only groups that reached this line
+    file << COMMIT_PREFIX << nextSequence - 1 << "\n";
+    file.close();
+    if (file.fail() || !syncFile(journalFile)) {
+        return false;
+    }
+    journaledEntries += pending.size();
+    pending.clear();
+    return true;
+}
+
+bool RosterJournal::compact(const Roster& roster) {
+    unsigned long long lastSequence = nextSequence - 1;
+    bool written = writeFileAtomically(snapshotFile, [&](std::ostream& out) {
+        writeRosterText(out, roster);
+        out << SEQUENCE_PREFIX << lastSequence << "\n";
+    });
+    if (!written) {
+        return false;
+    }
+
+    // Everything journaled so far is in the snapshot now. A crash before this
+    // truncation is harmless: replay skips entries up to lastSequence.
+    truncateJournal();
+    return true;
+}
+
+void RosterJournal::truncateJournal() {
+    std::ofstream truncate(journalFile, std::ios::binary | std::ios::trunc);
+    truncate.close();
+    syncFile(journalFile);
+    journaledEntries = 0;
+}
+
+bool RosterJournal::checkpoint(const Roster& roster) {
+    if (!compact(roster)) {
+        return false;
+    }
+    pending.clear();
+    return true;
+}
+
+bool RosterJournal::readSnapshotSequence(unsigned long long& sequence) const {
+    sequence = 0;
+    MappedFile file;
+    if (!file.open(snapshotFile)) {
+        return false;
+    }
+    std::string_view text = file.view();
+    size_t pos = text.rfind(SEQUENCE_PREFIX);
+    if (pos == std::string_view::npos || (pos > 0 && text[pos - 1] != '\n')) {
+        return false;
+    }
+    std::string_view value = text.substr(pos + SEQUENCE_PREFIX.size());
+    value = value.substr(0, value.find_first_of("\r\n"));
+    if (!parseSequence(value, sequence)) {
+        sequence = 0;
+        return false;
+    }
+    return true;
+}
+
+int RosterJournal::recover(Roster& roster) {
+    bool haveSnapshot = fileExists(snapshotFile);
+    bool haveJournal = fileExists(journalFile);
+    if (!haveSnapshot && !haveJournal) {
+        return -1;
+    }
+
+    // Replaying must not journal the replayed entries again
+    RosterJournal* attached = roster.getJournal();
+    roster.setJournal(nullptr);
+    pending.clear();
+
+    if (haveSnapshot && !loadRoster(roster, snapshotFile)) {
+        roster.setJournal(attached);
+        return -1;
+    }
+    unsigned long long base = 0;
+    readSnapshotSequence(base);
+    nextSequence = base + 1;
+    journaledEntries = 0;
+
+    // Entries up to the snapshot's JOURNALSEQ: are already in it; a snapshot
+    // without one predates the journal, so everything in it is replayed
+    int replayed = 0;
+    MappedFile file;
+    if (haveJournal && file.open(journalFile)) {
+        std::string_view text = file.view();
+        std::vector<std::pair<unsigned long long, std::string_view>> group;
+        size_t start = 0;
+        size_t validBytes = 0;
+        while (start < text.size()) {
+            size_t newline = text.find('\n', start);
+            if (newline == std::string_view::npos) {
+                break;   // Torn final write: the group was never committed
+            }
+            std::string_view line = text.substr(start, newline - start);
+            start = newline + 1;
+
+            unsigned long long sequence;
+            if (startsWith(line, COMMIT_PREFIX)) {
+                // The marker names the group's last entry, so a group missing
+                // its tail cannot be closed by a later marker
+                if (group.empty() || !parseSequence(line.substr(COMMIT_PREFIX.size()), sequence) ||
+                    sequence != group.back().first) {
+                    std::cerr << "  Warning: Journal is corrupt; later entries ignored.\n";
+                    break;
+                }
+                for (const auto& entry : group) {
+                    journaledEntries++;
+                    if (entry.first <= base) {
+                        continue;   // Already folded into the snapshot
+                    }
+                    nextSequence = std::max(nextSequence, entry.first + 1);
+                    if (applyEntry(roster, entry.second)) {
+                        replayed++;
+                    } else {
+                        std::cerr << "  Warning: Journal entry " << entry.first << " could not be applied.\n";
+                    }
+                }
+                group.clear();
+                validBytes = start;
+                continue;
+            }
+            size_t colon = line.find(':');
+            if (colon == std::string_view::npos || !parseSequence(line.substr(0, colon), sequence)) {
+                std::cerr << "  Warning: Journal is corrupt; later entries ignored.\n";
+                break;
+            }
+            group.emplace_back(sequence, line.substr(colon + 1));
+        }
+        if (!group.empty()) {
+            std::cerr << "  Warning: Journal ends in an unfinished commit; its "
+                      << group.size() << " entries were not replayed.\n";
+        }
+        file.close();
+
+        // Drop a torn, unfinished or corrupt tail so new groups start on a clean line
+        if (validBytes < text.size()) {
+            std::error_code ignored;
+            std::filesystem::resize_file(journalFile, validBytes, ignored);
+        }
+    }
+
+    roster.markSaved();
+    roster.setJournal(attached);
+    return replayed;
+}
+
+void RosterJournal::discardPending() {
+    pending.clear();
+}
+
+bool RosterJournal::hasPending() const {
+    return !pending.empty();
+}
+
+size_t RosterJournal::getJournaledEntries() const {
+    return journaledEntries;
+}
+
+const std::string& RosterJournal::getSnapshotFile() const {
+    return snapshotFile;
+}
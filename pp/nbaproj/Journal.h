@@ -0,0 +1,65 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <string>
+#include <vector>
+#include "Player.h"
+#include "FileHandler.h"
+
+const std::string JOURNAL_FILE = "roster.journal";
+
+// Write-ahead log of roster edits on top of a text snapshot.
+//
+// A Roster with a journal attached records every successful add, remove,
+// edit and team rename here. commit() appends the pending entries to the
+// journal file followed by a COMMIT: line naming the last of them, so a save
+// costs O(changes) rather than O(roster). Recovery replays only groups that
+// reached their COMMIT: line; a commit torn by a crash is dropped whole. Once
+// the journal holds `compactEvery` entries, commit() writes a fresh snapshot
+// atomically and empties the journal.
+//
+// Entries carry sequence numbers and each snapshot records the last one it
+// includes (a JOURNALSEQ: line the roster parser ignores). Replay skips
+// anything already in the snapshot, so a crash between writing the snapshot
+// and truncating the journal cannot apply an edit twice. File times play no
+// part: a snapshot without a JOURNALSEQ: line is taken to predate the
+// journal and gets all of it replayed. saveRoster() over the snapshot file of
+// a roster with a journal attached goes through checkpoint() for that reason;
+// a snapshot rewritten some other way (by hand, or --convert onto it) should
+// have its journal deleted alongside.
+class RosterJournal {
+private:
+    std::string journalFile;
+    std::string snapshotFile;
+    std::vector<std::string> pending;    // Encoded entries not yet on disk
+    unsigned long long nextSequence;
+    size_t journaledEntries;             // Entries in the journal file since the last snapshot
+    size_t compactEvery;
+
+    void record(const std::string& entry);
+    bool compact(const Roster& roster);
+    bool readSnapshotSequence(unsigned long long& sequence) const;
+    void truncateJournal();
+
+public:
+    RosterJournal(const std::string& journal = JOURNAL_FILE,
+                  const std::string& snapshot = DATA_FILE, size_t compactThreshold = 256);
+
+    // Called by Roster after each successful change
+    void recordAdd(const Player& p);
+    void recordRemove(int jerseyNumber);
+    void recordEdit(int jerseyNumber, const Player& p);
+    void recordTeamName(const std::string& name);
+    void takePending(RosterJournal& staged);   // Moves staged's entries here, renumbered
+
+    // Persistence
+    bool commit(const Roster& roster);
+    bool checkpoint(const Roster& roster);   // Write a full snapshot now and empty the journal
+    int recover(Roster& roster);   // Load snapshot, replay journal; returns entries replayed or -1
+    void discardPending();
+    bool hasPending() const;
+    size_t getJournaledEntries() const;
+    const std::string& getSnapshotFile() const;
+};
+
+#endif // JOURNAL_H
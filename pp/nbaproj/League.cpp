@@ -0,0 +1,294 @@
+#include "League.h"
+#include "TopK.h"
+#include <algorithm>
+#include <cctype>
+#include <numeric>
+#include <utility>
+
+League::League(int rosterSizeCap) : maxRosterSize(rosterSizeCap) {}
+
+bool League::isValidTeamSeason(int teamId, int season) const {
+    return teamId >= 0 && teamId < getTeamCount() && season >= 0 && season <= UINT16_MAX;
+}
+
+// Only meaningful for ids that pass isValidTeamSeason; others would alias
+uint32_t League::seasonKey(int teamId, int season) {
+    return (static_cast<uint32_t>(teamId) << 16) | static_cast<uint32_t>(season);
+}
+
+double League::recordStat(const PlayerRecord& r, PlayerStat stat) {
+    switch (stat) {
+        case PlayerStat::Points:   return r.pointsPerGame;
+        case PlayerStat::Rebounds: return r.reboundsPerGame;
+        case PlayerStat::Assists:  return r.assistsPerGame;
+        case PlayerStat::Height:   return r.heightInches;
+        case PlayerStat::Weight:   return r.weightLbs;
+        case PlayerStat::Age:      return r.age;
+    }
+    return 0.0;
+}
+
+const League::TeamSeason* League::findSeason(int teamId, int season) const {
+    if (!isValidTeamSeason(teamId, season)) {
+        return nullptr;
+    }
+    auto it = seasons.find(seasonKey(teamId, season));
+    return it == seasons.end() ? nullptr : &it->second;
+}
+
+int League::addTeam(const std::string& name) {
+    int existing = findTeam(name);
+    if (existing != -1) {
+        return existing;
+    }
+    if (teamNames.size() > UINT16_MAX) {
+        return -1;
+    }
+    int teamId = static_cast<int>(teamNames.size());
+    teamNames.push_back(name);
+    teamIds.emplace(name, teamId);
+    return teamId;
+}
+
+int League::findTeam(const std::string& name) const {
+    auto it = teamIds.find(name);
+    return it == teamIds.end() ? -1 : it->second;
+}
+
+int League::getTeamCount() const {
+    return static_cast<int>(teamNames.size());
+}
+
+const std::string& League::getTeamName(int teamId) const {
+    static const std::string unknown;
+    if (teamId < 0 || teamId >= getTeamCount()) {
+        return unknown;
+    }
+    return teamNames[teamId];
+}
+
+bool League::addPlayer(int teamId, int season, const Player& p) {
+    if (!isValidTeamSeason(teamId, season)) {
+        return false;
+    }
+    // Reject anything that does not fit the compact record
+    int pos = positionIndex(p.position);
+    if (pos == -1 || p.jerseyNumber < MIN_JERSEY || p.jerseyNumber > MAX_JERSEY ||
+        p.heightInches < 0 || p.heightInches > UINT8_MAX ||
+        p.age < 0 || p.age > UINT8_MAX ||
+        p.weightLbs < 0 || p.weightLbs > UINT16_MAX) {
+        return false;
+    }
+
+    TeamSeason& ts = seasons[seasonKey(teamId, season)];
+    if (ts.jerseySlots.empty()) {
+        ts.jerseySlots.assign(MAX_JERSEY - MIN_JERSEY + 1, NO_RECORD);
+        ts.size = 0;
+    }
+    if (ts.size >= maxRosterSize) {
+        return false;
+    }
+    uint32_t& slot = ts.jerseySlots[p.jerseyNumber - MIN_JERSEY];
+    if (slot != NO_RECORD) {
+        return false;
+    }
+
+    PlayerRecord r;
+    r.firstName = p.firstName;
+    r.lastName = p.lastName;
+    r.teamId = static_cast<uint16_t>(teamId);
+    r.season = static_cast<uint16_t>(season);
+    r.jerseyNumber = static_cast<uint8_t>(p.jerseyNumber);
+    r.position = static_cast<uint8_t>(pos);
+    r.heightInches = static_cast<uint8_t>(p.heightInches);
+    r.age = static_cast<uint8_t>(p.age);
+    r.weightLbs = static_cast<uint16_t>(p.weightLbs);
+    r.pointsPerGame = static_cast<float>(p.pointsPerGame);
+    r.reboundsPerGame = static_cast<float>(p.reboundsPerGame);
+    r.assistsPerGame = static_cast<float>(p.assistsPerGame);
+
+    slot = static_cast<uint32_t>(records.size());
+    records.push_back(r);
+    nameIndex.insert(slot, p.firstName, p.lastName);
+    fuzzyNames.insert(slot, p.firstName, p.lastName);
+    ts.size++;
+    return true;
+}
+
+bool League::removePlayer(int teamId, int season, int jerseyNumber) {
+    if (jerseyNumber < MIN_JERSEY || jerseyNumber > MAX_JERSEY || !isValidTeamSeason(teamId, season)) {
+        return false;
+    }
+    auto it = seasons.find(seasonKey(teamId, season));
+    if (it == seasons.end()) {
+        return false;
+    }
+    uint32_t& slot = it->second.jerseySlots[jerseyNumber - MIN_JERSEY];
+    if (slot == NO_RECORD) {
+        return false;
+    }
+
+    // Swap-remove keeps deletion O(1); only the moved record's slot needs fixing
+    uint32_t id = slot;
+    uint32_t last = static_cast<uint32_t>(records.size() - 1);
+    slot = NO_RECORD;
+    it->second.size--;
+    nameIndex.remove(id);
+    fuzzyNames.remove(id);
+    if (id != last) {
+        PlayerRecord& moved = records[last];
+        TeamSeason& movedSeason = seasons[seasonKey(moved.teamId, moved.season)];
+        movedSeason.jerseySlots[moved.jerseyNumber - MIN_JERSEY] = id;
+        nameIndex.remove(last);
+        nameIndex.insert(id, moved.firstName, moved.lastName);
+        fuzzyNames.remove(last);
+        fuzzyNames.insert(id, moved.firstName, moved.lastName);
+        records[id] = std::move(moved);
+    }
+    records.pop_back();
+    return true;
+}
+
+int League::importRoster(const Roster& roster, int season) {
+    int teamId = addTeam(roster.getTeamName());
+    if (teamId == -1) {
+        return 0;
+    }
+    int added = 0;
+    for (const auto& player : roster.getPlayers()) {
+        if (addPlayer(teamId, season, player)) {
+            added++;
+        }
+    }
+    return added;
+}
+
+uint32_t League::findByJersey(int teamId, int season, int jerseyNumber) const {
+    if (jerseyNumber < MIN_JERSEY || jerseyNumber > MAX_JERSEY) {
+        return NO_RECORD;
+    }
+    const TeamSeason* ts = findSeason(teamId, season);
+    return ts == nullptr ? NO_RECORD : ts->jerseySlots[jerseyNumber - MIN_JERSEY];
+}
+
+std::vector<uint32_t> League::findByName(const std::string& name) const {
+    return nameIndex.find(name);
+}
+
+std::vector<uint32_t> League::findByNameFuzzy(const std::string& name, size_t limit) const {
+    std::vector<uint32_t> results;
+    for (const FuzzyMatch& match :
+         fuzzyNames.search(name, FuzzyNameIndex::defaultMaxDistance(name), limit)) {
+        results.push_back(match.id);
+    }
+    return results;
+}
+
+std::vector<uint32_t> League::findByPosition(const std::string& pos) const {
+    return select(PlayerQuery().positionIn({pos}));
+}
+
+std::vector<uint32_t> League::findByStatRange(PlayerStat stat, double min, double max) const {
+    return select(PlayerQuery().where(stat, Compare::GreaterEqual, min)
+                               .where(stat, Compare::LessEqual, max));
+}
+
+std::vector<uint32_t> League::select(const PlayerQuery& query) const {
+    // Names are the only league-wide index; everything else narrows a full scan
+    std::vector<uint32_t> ids;
+    if (query.hasName()) {
+        ids = nameIndex.find(query.getName());
+    } else {
+        ids.resize(records.size());
+        std::iota(ids.begin(), ids.end(), 0);
+    }
+
+    if (query.hasJersey()) {
+        PlayerQuery::keepIf(ids, [&](uint32_t id) {
+            return records[id].jerseyNumber == query.getJersey();
+        });
+    }
+    if (query.hasPositionFilter()) {
+        PlayerQuery::keepIf(ids, [&](uint32_t id) {
+            return query.allowsPosition(records[id].position);
+        });
+    }
+    auto statOf = [&](uint32_t id, PlayerStat stat) { return recordStat(records[id], stat); };
+    query.applyConditions(ids, statOf);
+    query.orderAndLimit(ids, statOf);
+    return ids;
+}
+
+std::vector<uint32_t> League::topPlayers(PlayerStat stat, size_t k) const {
+    std::vector<uint32_t> results;
+    for (size_t index : topKBy(records.size(), k,
+                               [&](size_t i) { return recordStat(records[i], stat); })) {
+        results.push_back(static_cast<uint32_t>(index));
+    }
+    return results;
+}
+
+std::vector<uint32_t> League::topPlayers(const StatWeights& weights, size_t k) const {
+    std::vector<uint32_t> results;
+    for (size_t index : topKBy(records.size(), k, [&](size_t i) {
+             const PlayerRecord& r = records[i];
+             return r.pointsPerGame * weights.points + r.reboundsPerGame * weights.rebounds +
+                    r.assistsPerGame * weights.assists;
+         })) {
+        results.push_back(static_cast<uint32_t>(index));
+    }
+    return results;
+}
+
+const PlayerRecord& League::getRecord(uint32_t id) const {
+    return records[id];
+}
+
+double League::getStat(uint32_t id, PlayerStat stat) const {
+    return recordStat(records[id], stat);
+}
+
+Player League::toPlayer(uint32_t id) const {
+    const PlayerRecord& r = records[id];
+    // Copying the pooled names skips looking them up again
+    Player p;
+    p.firstName = r.firstName;
+    p.lastName = r.lastName;
+    p.jerseyNumber = r.jerseyNumber;
+    p.position = InternedString(VALID_POSITIONS[r.position]);
+    p.heightInches = r.heightInches;
+    p.weightLbs = r.weightLbs;
+    p.age = r.age;
+    p.pointsPerGame = r.pointsPerGame;
+    p.reboundsPerGame = r.reboundsPerGame;
+    p.assistsPerGame = r.assistsPerGame;
+    return p;
+}
+
+Roster League::toRoster(int teamId, int season) const {
+    if (teamId < 0 || teamId >= getTeamCount()) {
+        return Roster("", maxRosterSize);
+    }
+    Roster roster(getTeamName(teamId), maxRosterSize);
+    const TeamSeason* ts = findSeason(teamId, season);
+    if (ts != nullptr) {
+        std::vector<Player> players;
+        players.reserve(ts->size);
+        for (uint32_t id : ts->jerseySlots) {
+            if (id != NO_RECORD) {
+                players.push_back(toPlayer(id));
+            }
+        }
+        roster.setPlayers(std::move(players));
+    }
+    return roster;
+}
+
+size_t League::getRecordCount() const {
+    return records.size();
+}
+
+int League::getTeamSize(int teamId, int season) const {
+    const TeamSeason* ts = findSeason(teamId, season);
+    return ts == nullptr ? 0 : ts->size;
+}
@@ -0,0 +1,92 @@
+#ifndef LEAGUE_H
+#define LEAGUE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Player.h"
+#include "Roster.h"
+#include "FuzzyNameIndex.h"
+#include "InputValidator.h"
+#include "NameIndex.h"
+#include "Query.h"
+
+// Compact league-wide player record. Names are the same pooled strings the
+// Players carry and the position is an index into VALID_POSITIONS, so a
+// record is 32 bytes with no heap allocations of its own.
+struct PlayerRecord {
+    InternedString firstName;
+    InternedString lastName;
+    uint16_t teamId;
+    uint16_t season;
+    uint8_t jerseyNumber;
+    uint8_t position;
+    uint8_t heightInches;
+    uint8_t age;
+    uint16_t weightLbs;
+    float pointsPerGame;
+    float reboundsPerGame;
+    float assistsPerGame;
+};
+
+class League {
+private:
+    // Roster invariants (jersey uniqueness, size cap) are enforced per team season
+    struct TeamSeason {
+        std::vector<uint32_t> jerseySlots;   // jersey -> record id, NO_RECORD when free
+        int size;
+    };
+
+    std::vector<std::string> teamNames;
+    std::unordered_map<std::string, int> teamIds;   // Name -> index into teamNames
+    std::vector<PlayerRecord> records;
+    std::unordered_map<uint32_t, TeamSeason> seasons;
+    NameIndex nameIndex;   // Full names by record id
+    FuzzyNameIndex fuzzyNames;
+    int maxRosterSize;
+
+    bool isValidTeamSeason(int teamId, int season) const;
+    static uint32_t seasonKey(int teamId, int season);
+    static double recordStat(const PlayerRecord& r, PlayerStat stat);
+    const TeamSeason* findSeason(int teamId, int season) const;
+
+public:
+    static constexpr uint32_t NO_RECORD = UINT32_MAX;
+
+    // Constructor
+    explicit League(int rosterSizeCap = MAX_ROSTER_SIZE);
+
+    // Teams
+    int addTeam(const std::string& name);
+    int findTeam(const std::string& name) const;
+    int getTeamCount() const;
+    const std::string& getTeamName(int teamId) const;   // Empty for an unknown id
+
+    // Core operations. Record ids are invalidated by removePlayer.
+    bool addPlayer(int teamId, int season, const Player& p);
+    bool removePlayer(int teamId, int season, int jerseyNumber);
+    int importRoster(const Roster& roster, int season);
+
+    // Query operations, returning record ids
+    uint32_t findByJersey(int teamId, int season, int jerseyNumber) const;
+    std::vector<uint32_t> findByName(const std::string& name) const;
+    std::vector<uint32_t> findByNameFuzzy(const std::string& name, size_t limit) const;   // Closest first
+    std::vector<uint32_t> findByPosition(const std::string& pos) const;
+    std::vector<uint32_t> findByStatRange(PlayerStat stat, double min, double max) const;
+    std::vector<uint32_t> select(const PlayerQuery& query) const;
+
+    // Ranking, best first
+    std::vector<uint32_t> topPlayers(PlayerStat stat, size_t k) const;
+    std::vector<uint32_t> topPlayers(const StatWeights& weights, size_t k) const;
+
+    // Record access
+    const PlayerRecord& getRecord(uint32_t id) const;
+    double getStat(uint32_t id, PlayerStat stat) const;
+    Player toPlayer(uint32_t id) const;
+    Roster toRoster(int teamId, int season) const;   // Empty, unnamed for an unknown team
+    size_t getRecordCount() const;
+    int getTeamSize(int teamId, int season) const;
+};
+
+#endif // LEAGUE_H
@@ -0,0 +1,71 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() : mappedData(nullptr), mappedSize(0), isMapped(false) {}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd != -1) {
+        struct stat info;
+        if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+            if (info.st_size == 0) {
+                ::close(fd);
+                return true;   // Empty file: nothing to map
+            }
+            void* addr = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                // The loaders walk the file front to back exactly once
+                madvise(addr, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+                ::close(fd);
+                mappedData = static_cast<const char*>(addr);
+                mappedSize = static_cast<size_t>(info.st_size);
+                isMapped = true;
+                return true;
+            }
+        }
+        ::close(fd);
+    }
+#endif
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    buffer = contents.str();
+    mappedData = buffer.data();
+    mappedSize = buffer.size();
+    return true;
+}
+
+void MappedFile::close() {
+#ifndef _WIN32
+    if (isMapped) {
+        munmap(const_cast<char*>(mappedData), mappedSize);
+    }
+#endif
+    mappedData = nullptr;
+    mappedSize = 0;
+    isMapped = false;
+    buffer.clear();
+}
+
+std::string_view MappedFile::view() const {
+    return std::string_view(mappedData, mappedSize);
+}
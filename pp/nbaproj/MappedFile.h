@@ -0,0 +1,28 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <string_view>
+
+// Read-only view of a whole file. Uses mmap where available and falls back
+// to reading the file into memory elsewhere. The view is valid until close()
+// or destruction.
+class MappedFile {
+private:
+    const char* mappedData;
+    size_t mappedSize;
+    bool isMapped;
+    std::string buffer;   // Fallback storage when the file is not mapped
+
+public:
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& filename);
+    void close();
+    std::string_view view() const;
+};
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,212 @@
+#include "NameIndex.h"
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+namespace {
+
+void appendLower(std::string& out, const std::string& str) {
+    for (char c : str) {
+        out.push_back(static_cast<char>(::tolower(static_cast<unsigned char>(c))));
+    }
+}
+
+} // namespace
+
+NameIndex::NameIndex() : deadBytes(0), count(0) {}
+
+std::string_view NameIndex::nameOf(uint32_t id) const {
+    return std::string_view(arena.data() + nameStart[id], nameLength[id]);
+}
+
+void NameIndex::trigramsOf(std::string_view lower, std::vector<uint32_t>& grams) {
+    grams.clear();
+    for (size_t i = 0; i + 3 <= lower.size(); ++i) {
+        grams.push_back((static_cast<uint32_t>(static_cast<unsigned char>(lower[i])) << 16) |
+                        (static_cast<uint32_t>(static_cast<unsigned char>(lower[i + 1])) << 8) |
+                        static_cast<uint32_t>(static_cast<unsigned char>(lower[i + 2])));
+    }
+    // A repeated trigram must not list the same id twice
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+}
+
+void NameIndex::reserve(size_t ids, size_t nameBytes) {
+    nameStart.reserve(ids);
+    nameLength.reserve(ids);
+    present.reserve(ids);
+    arena.reserve(arena.size() + nameBytes);
+}
+
+void NameIndex::insert(uint32_t id, const std::string& name) {
+    if (id < present.size() && present[id]) {
+        remove(id);
+    }
+    size_t start = arena.size();
+    appendLower(arena, name);
+    nameStart.resize(std::max<size_t>(nameStart.size(), id + 1), 0);
+    nameStart[id] = static_cast<uint32_t>(start);
+    add(id);
+}
+
+void NameIndex::insert(uint32_t id, const std::string& firstName, const std::string& lastName) {
+    if (id < present.size() && present[id]) {
+        remove(id);
+    }
+    size_t start = arena.size();
+    appendLower(arena, firstName);
+    arena.push_back(' ');
+    appendLower(arena, lastName);
+    nameStart.resize(std::max<size_t>(nameStart.size(), id + 1), 0);
+    nameStart[id] = static_cast<uint32_t>(start);
+    add(id);
+}
+
+void NameIndex::add(uint32_t id) {
+    if (id >= present.size()) {
+        present.resize(id + 1, false);
+        nameLength.resize(id + 1, 0);
+    }
+    nameLength[id] = static_cast<uint32_t>(arena.size() - nameStart[id]);
+    present[id] = true;
+    count++;
+    
+    trigramsOf(nameOf(id), scratchGrams);
+    for (uint32_t gram : scratchGrams) {
+        // Posting lists stay sorted; ids usually arrive in order, so this appends
+        std::vector<uint32_t>& ids = postings[gram];
+        if (ids.empty() || ids.back() < id) {
+            ids.push_back(id);
+        } else {
+            ids.insert(std::lower_bound(ids.begin(), ids.end(), id), id);
+        }
+    }
+}
+
+void NameIndex::remove(uint32_t id) {
+    if (id >= present.size() || !present[id]) {
+        return;
+    }
+    trigramsOf(nameOf(id), scratchGrams);
+    for (uint32_t gram : scratchGrams) {
+        auto it = postings.find(gram);
+        if (it == postings.end()) continue;
+        std::vector<uint32_t>& ids = it->second;
+        auto pos = std::lower_bound(ids.begin(), ids.end(), id);
+        if (pos != ids.end() && *pos == id) {
+            ids.erase(pos);
+        }
+        if (ids.empty()) {
+            postings.erase(it);
+        }
+    }
+    deadBytes += nameLength[id];
+    nameLength[id] = 0;
+    present[id] = false;
+    count--;
+    
+    // Swap-removes re-add names, so reclaim the arena once it is mostly dead
+    if (deadBytes > arena.size() / 2 && deadBytes > 4096) {
+        compact();
+    }
+}
+
+void NameIndex::compact() {
+    std::string live;
+    live.reserve(arena.size() - deadBytes);
+    for (size_t id = 0; id < present.size(); ++id) {
+        if (present[id]) {
+            std::string_view name = nameOf(static_cast<uint32_t>(id));
+            nameStart[id] = static_cast<uint32_t>(live.size());
+            live.append(name.data(), name.size());
+        }
+    }
+    arena.swap(live);
+    deadBytes = 0;
+}
+
+void NameIndex::clear() {
+    postings.clear();
+    arena.clear();
+    arena.shrink_to_fit();
+    nameStart.clear();
+    nameLength.clear();
+    present.clear();
+    deadBytes = 0;
+    count = 0;
+}
+
+size_t NameIndex::size() const {
+    return count;
+}
+
+template <typename Id>
+void NameIndex::findInto(const std::string& query, NameSearch& search, std::vector<Id>& results) const {
+    results.clear();
+    std::string& lower = search.lower;
+    lower.clear();
+    appendLower(lower, query);
+
+    std::vector<uint32_t>& grams = search.grams;
+    grams.reserve(lower.size());
+    trigramsOf(lower, grams);
+    if (grams.empty()) {
+        for (size_t id = 0; id < present.size(); ++id) {
+            if (present[id] && nameOf(static_cast<uint32_t>(id)).find(lower) != std::string_view::npos) {
+                results.push_back(static_cast<Id>(id));
+            }
+        }
+        return;
+    }
+
+    // Every match appears under every query trigram, so intersect the
+    // posting lists rarest first and verify only what survives
+    std::vector<const std::vector<uint32_t>*>& lists = search.lists;
+    lists.clear();
+    lists.reserve(grams.size());
+    for (uint32_t gram : grams) {
+        auto it = postings.find(gram);
+        if (it == postings.end()) {
+            return;
+        }
+        lists.push_back(&it->second);
+    }
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<uint32_t>* a, const std::vector<uint32_t>* b) {
+                  return a->size() < b->size();
+              });
+
+    // Merging with a list far longer than the candidates costs more than
+    // verifying the candidates directly, so stop once the lists get long.
+    // Until a merge narrows them, candidates are read straight off the list.
+    const std::vector<uint32_t>* candidates = lists[0];
+    std::vector<uint32_t>& merged = search.merged;
+    std::vector<uint32_t>& narrowed = search.narrowed;
+    for (size_t i = 1; i < lists.size() && lists[i]->size() <= candidates->size() * 4; ++i) {
+        narrowed.clear();
+        narrowed.reserve(candidates->size());   // Candidates only shrink: one allocation per buffer
+        std::set_intersection(candidates->begin(), candidates->end(),
+                              lists[i]->begin(), lists[i]->end(), std::back_inserter(narrowed));
+        merged.swap(narrowed);
+        candidates = &merged;
+    }
+
+    // Trigrams can match out of order, so confirm the whole query
+    results.reserve(candidates->size());
+    for (uint32_t id : *candidates) {
+        if (nameOf(id).find(lower) != std::string_view::npos) {
+            results.push_back(static_cast<Id>(id));
+        }
+    }
+}
+
+std::vector<uint32_t> NameIndex::find(const std::string& query) const {
+    NameSearch search;
+    std::vector<uint32_t> results;
+    findInto(query, search, results);
+    return results;
+}
+
+void NameIndex::find(const std::string& query, NameSearch& search) const {
+    findInto(query, search, search.results);
+}
@@ -0,0 +1,65 @@
+#ifndef NAMEINDEX_H
+#define NAMEINDEX_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Working memory for NameIndex::find. A caller that keeps one across
+// queries stops allocating once its buffers have grown to fit.
+struct NameSearch {
+    std::string lower;
+    std::vector<uint32_t> grams;
+    std::vector<const std::vector<uint32_t>*> lists;
+    std::vector<uint32_t> merged;
+    std::vector<uint32_t> narrowed;
+    std::vector<int> results;   // Ids of the last find, as PlayerRange holds them
+};
+
+// Case-insensitive substring index over names, keyed by caller-chosen ids.
+// Every lowercase trigram of a name maps to the ids containing it; a query
+// intersects the posting lists of its trigrams instead of scanning all
+// names. Queries shorter than three characters fall back to a scan.
+// Posting lists are kept sorted, so removing an id is linear in the size of
+// each list it appears in.
+class NameIndex {
+private:
+    std::unordered_map<uint32_t, std::vector<uint32_t>> postings;
+
+    // Lowercase names live back to back in one monotonic buffer instead of
+    // one string each. Removed names stay behind as dead bytes until the
+    // buffer is compacted or cleared, which frees everything at once.
+    std::string arena;
+    std::vector<uint32_t> nameStart;    // By id
+    std::vector<uint32_t> nameLength;   // By id
+    std::vector<bool> present;          // By id
+    size_t deadBytes;
+    size_t count;
+    std::vector<uint32_t> scratchGrams;
+
+    std::string_view nameOf(uint32_t id) const;
+    void add(uint32_t id);   // Indexes the name just appended to the arena
+    void compact();
+    static void trigramsOf(std::string_view lower, std::vector<uint32_t>& grams);
+    template <typename Id>
+    void findInto(const std::string& query, NameSearch& search, std::vector<Id>& results) const;
+
+public:
+    NameIndex();
+
+    void insert(uint32_t id, const std::string& name);
+    void insert(uint32_t id, const std::string& firstName, const std::string& lastName);   // "first last"
+    void reserve(size_t ids, size_t nameBytes);
+    void remove(uint32_t id);
+    void clear();
+    size_t size() const;
+
+    // Ids whose name contains `query`, in ascending order
+    std::vector<uint32_t> find(const std::string& query) const;
+    // Same, into search.results, reusing `search`'s buffers
+    void find(const std::string& query, NameSearch& search) const;
+};
+
+#endif // NAMEINDEX_H
@@ -1,29 +1,59 @@
 #include "Player.h"
+#include "TextBuffer.h"
 #include <iostream>
 #include <iomanip>
-#include <sstream>
+
+double statValue(const Player& p, PlayerStat stat) {
+    switch (stat) {
+        case PlayerStat::Points:   return p.pointsPerGame;
+        case PlayerStat::Rebounds: return p.reboundsPerGame;
+        case PlayerStat::Assists:  return p.assistsPerGame;
+        case PlayerStat::Height:   return p.heightInches;
+        case PlayerStat::Weight:   return p.weightLbs;
+        case PlayerStat::Age:      return p.age;
+    }
+    return 0.0;
+}
+
+double compositeValue(const Player& p, const StatWeights& weights) {
+    return p.pointsPerGame * weights.points + p.reboundsPerGame * weights.rebounds +
+           p.assistsPerGame * weights.assists;
+}
 
 std::string formatHeight(int inches) {
-    int feet = inches / 12;
-    int remainingInches = inches % 12;
-    std::ostringstream oss;
-    oss << feet << "'" << remainingInches << "\"";
-    return oss.str();
+    TextBuffer out;
+    appendHeight(out, inches);
+    return out.str();
 }
 
 std::string formatPlayerRow(const Player& p) {
-    std::ostringstream oss;
-    oss << "| #" << std::setw(2) << std::setfill('0') << p.jerseyNumber << " | "
-        << std::setfill(' ') << std::left << std::setw(20) 
-        << (p.lastName + ", " + p.firstName).substr(0, 20) << " | "
-        << std::setw(2) << p.position << " | "
-        << std::setw(6) << formatHeight(p.heightInches) << " | "
-        << std::right << std::setw(3) << p.weightLbs << " | "
-        << std::fixed << std::setprecision(1)
-        << std::setw(5) << p.pointsPerGame << " | "
-        << std::setw(5) << p.reboundsPerGame << " | "
-        << std::setw(5) << p.assistsPerGame << " |";
-    return oss.str();
+    TextBuffer out;
+    appendPlayerRow(out, p);
+    return out.str();
+}
+
+void appendHeight(TextBuffer& out, int inches) {
+    out.appendInt(inches / 12).append('\'').appendInt(inches % 12).append('"');
+}
+
+void appendNameColumn(TextBuffer& out, const Player& p) {
+    size_t start = out.size();
+    out.append(p.lastName.str()).append(", ").append(p.firstName.str());
+    out.truncateFrom(start, 20);
+    out.padFrom(start, 20);
+}
+
+void appendPlayerRow(TextBuffer& out, const Player& p) {
+    out.append("| #").appendInt(p.jerseyNumber, 2, '0').append(" | ");
+    appendNameColumn(out, p);
+    out.append(" | ").padRight(p.position.str(), 2).append(" | ");
+    size_t heightStart = out.size();
+    appendHeight(out, p.heightInches);
+    out.padFrom(heightStart, 6);
+    out.append(" | ").appendInt(p.weightLbs, 3).append(" | ")
+       .appendFixed(p.pointsPerGame, 1, 5).append(" | ")
+       .appendFixed(p.reboundsPerGame, 1, 5).append(" | ")
+       .appendFixed(p.assistsPerGame, 1, 5).append(" |");
 }
 
 void displayPlayer(const Player& p) {
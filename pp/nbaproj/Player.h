@@ -2,12 +2,16 @@
 #define PLAYER_H
 
 #include <string>
+#include "InternedString.h"
 
+class TextBuffer;
+
+// Names and position are pooled ids, so a Player owns no heap memory
 struct Player {
-    std::string firstName;
-    std::string lastName;
+    InternedString firstName;
+    InternedString lastName;
     int jerseyNumber;         // Range: 0-99
-    std::string position;     // Valid: "PG", "SG", "SF", "PF", "C"
+    InternedString position;  // Valid: "PG", "SG", "SF", "PF", "C"
     int heightInches;         // Total height in inches
     int weightLbs;            // Weight in pounds
     int age;                  // Age in years
@@ -28,9 +32,35 @@ struct Player {
           pointsPerGame(ppg), reboundsPerGame(rpg), assistsPerGame(apg) {}
 };
 
+// Numeric fields that can be filtered, aggregated or ranked on
+enum class PlayerStat {
+    Points,
+    Rebounds,
+    Assists,
+    Height,
+    Weight,
+    Age
+};
+
+// Weighted PPG/RPG/APG score used for composite rankings
+struct StatWeights {
+    double points;
+    double rebounds;
+    double assists;
+
+    StatWeights(double pts = 1.0, double reb = 1.0, double ast = 1.0)
+        : points(pts), rebounds(reb), assists(ast) {}
+};
+
 // Utility functions
+double statValue(const Player& p, PlayerStat stat);
+double compositeValue(const Player& p, const StatWeights& weights);
 std::string formatHeight(int inches);
 std::string formatPlayerRow(const Player& p);
+// Same text as formatHeight/formatPlayerRow, written straight into `out`
+void appendHeight(TextBuffer& out, int inches);
+void appendPlayerRow(TextBuffer& out, const Player& p);
+void appendNameColumn(TextBuffer& out, const Player& p);   // "Last, First" in 20 columns
 void displayPlayer(const Player& p);
 
 #endif // PLAYER_H
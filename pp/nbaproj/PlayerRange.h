@@ -0,0 +1,61 @@
+#ifndef PLAYERRANGE_H
+#define PLAYERRANGE_H
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "Player.h"
+
+// Non-owning view of roster players picked by index; iterating yields
+// const Player&. The indices are either borrowed from a roster index or
+// held by the range itself. Either way the range is only valid until the
+// roster it came from is next modified.
+class PlayerRange {
+private:
+    const Player* players;
+    const int* borrowed;
+    size_t borrowedSize;
+    std::vector<int> owned;
+    bool isOwned;
+
+    const int* indices() const { return isOwned ? owned.data() : borrowed; }
+
+public:
+    class iterator {
+    private:
+        const Player* players;
+        const int* pos;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Player value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const Player* pointer;
+        typedef const Player& reference;
+
+        iterator(const Player* base, const int* at) : players(base), pos(at) {}
+        reference operator*() const { return players[*pos]; }
+        pointer operator->() const { return &players[*pos]; }
+        iterator& operator++() { ++pos; return *this; }
+        iterator operator++(int) { iterator old = *this; ++pos; return old; }
+        bool operator==(const iterator& other) const { return pos == other.pos; }
+        bool operator!=(const iterator& other) const { return pos != other.pos; }
+    };
+
+    // Borrows `count` indices starting at `first`
+    PlayerRange(const Player* base, const int* first, size_t count)
+        : players(base), borrowed(first), borrowedSize(count), isOwned(false) {}
+
+    // Takes ownership of the indices
+    PlayerRange(const Player* base, std::vector<int> ids)
+        : players(base), borrowed(nullptr), borrowedSize(0), owned(std::move(ids)), isOwned(true) {}
+
+    iterator begin() const { return iterator(players, indices()); }
+    iterator end() const { return iterator(players, indices() + size()); }
+    size_t size() const { return isOwned ? owned.size() : borrowedSize; }
+    bool empty() const { return size() == 0; }
+    const Player& operator[](size_t i) const { return players[indices()[i]]; }
+};
+
+#endif // PLAYERRANGE_H
@@ -0,0 +1,106 @@
+#include "PlayerTable.h"
+
+PlayerTable::PlayerTable(const std::vector<Player>& players) {
+    reserve(players.size());
+    for (const auto& player : players) {
+        append(player);
+    }
+}
+
+void PlayerTable::append(const Player& p) {
+    firstNames.push_back(p.firstName);
+    lastNames.push_back(p.lastName);
+    positions.push_back(p.position);
+    jerseyNumbers.push_back(p.jerseyNumber);
+    heights.push_back(p.heightInches);
+    weights.push_back(p.weightLbs);
+    ages.push_back(p.age);
+    points.push_back(p.pointsPerGame);
+    rebounds.push_back(p.reboundsPerGame);
+    assists.push_back(p.assistsPerGame);
+}
+
+void PlayerTable::reserve(size_t count) {
+    firstNames.reserve(count);
+    lastNames.reserve(count);
+    positions.reserve(count);
+    jerseyNumbers.reserve(count);
+    heights.reserve(count);
+    weights.reserve(count);
+    ages.reserve(count);
+    points.reserve(count);
+    rebounds.reserve(count);
+    assists.reserve(count);
+}
+
+void PlayerTable::clear() {
+    *this = PlayerTable();
+}
+
+Player PlayerTable::getPlayer(size_t row) const {
+    Player p;
+    p.firstName = firstNames[row];
+    p.lastName = lastNames[row];
+    p.jerseyNumber = jerseyNumbers[row];
+    p.position = positions[row];
+    p.heightInches = heights[row];
+    p.weightLbs = weights[row];
+    p.age = ages[row];
+    p.pointsPerGame = points[row];
+    p.reboundsPerGame = rebounds[row];
+    p.assistsPerGame = assists[row];
+    return p;
+}
+
+std::vector<Player> PlayerTable::toPlayers() const {
+    std::vector<Player> players;
+    players.reserve(size());
+    for (size_t row = 0; row < size(); ++row) {
+        players.push_back(getPlayer(row));
+    }
+    return players;
+}
+
+size_t PlayerTable::size() const {
+    return jerseyNumbers.size();
+}
+
+const std::string& PlayerTable::getFirstName(size_t row) const {
+    return firstNames[row].str();
+}
+
+const std::string& PlayerTable::getLastName(size_t row) const {
+    return lastNames[row].str();
+}
+
+const std::string& PlayerTable::getPosition(size_t row) const {
+    return positions[row].str();
+}
+
+const std::vector<int>& PlayerTable::getJerseyNumbers() const {
+    return jerseyNumbers;
+}
+
+const std::vector<int>& PlayerTable::getHeights() const {
+    return heights;
+}
+
+const std::vector<int>& PlayerTable::getWeights() const {
+    return weights;
+}
+
+const std::vector<int>& PlayerTable::getAges() const {
+    return ages;
+}
+
+const std::vector<double>& PlayerTable::getPoints() const {
+    return points;
+}
+
+const std::vector<double>& PlayerTable::getRebounds() const {
+    return rebounds;
+}
+
+const std::vector<double>& PlayerTable::getAssists() const {
+    return assists;
+}
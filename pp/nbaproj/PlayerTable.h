@@ -0,0 +1,52 @@
+#ifndef PLAYERTABLE_H
+#define PLAYERTABLE_H
+
+#include <cstdint>
+#include <vector>
+#include "Player.h"
+
+// Columnar (structure-of-arrays) copy of a player list for analytics.
+// Each numeric field lives in its own contiguous array so stat scans touch
+// only the column they need; names and positions stay pooled InternedStrings.
+class PlayerTable {
+private:
+    std::vector<InternedString> firstNames;
+    std::vector<InternedString> lastNames;
+    std::vector<InternedString> positions;
+    std::vector<int> jerseyNumbers;
+    std::vector<int> heights;
+    std::vector<int> weights;
+    std::vector<int> ages;
+    std::vector<double> points;
+    std::vector<double> rebounds;
+    std::vector<double> assists;
+
+public:
+    // Constructors
+    PlayerTable() = default;
+    explicit PlayerTable(const std::vector<Player>& players);
+
+    // Building
+    void append(const Player& p);
+    void reserve(size_t count);
+    void clear();
+
+    // Conversion back to records
+    Player getPlayer(size_t row) const;
+    std::vector<Player> toPlayers() const;
+
+    // Column access
+    size_t size() const;
+    const std::string& getFirstName(size_t row) const;
+    const std::string& getLastName(size_t row) const;
+    const std::string& getPosition(size_t row) const;
+    const std::vector<int>& getJerseyNumbers() const;
+    const std::vector<int>& getHeights() const;
+    const std::vector<int>& getWeights() const;
+    const std::vector<int>& getAges() const;
+    const std::vector<double>& getPoints() const;
+    const std::vector<double>& getRebounds() const;
+    const std::vector<double>& getAssists() const;
+};
+
+#endif // PLAYERTABLE_H
@@ -0,0 +1,80 @@
+#include "Query.h"
+#include "InputValidator.h"
+#include <algorithm>
+#include <cctype>
+
+PlayerQuery::PlayerQuery()
+    : filterPositions(false), positionMask(0), filterJersey(false), jersey(0),
+      filterName(false), ordered(false), orderStat(PlayerStat::Points), descending(true),
+      maxResults(SIZE_MAX) {}
+
+PlayerQuery& PlayerQuery::positionIn(const std::vector<std::string>& positions) {
+    filterPositions = true;
+    positionMask = 0;
+    for (const auto& pos : positions) {
+        std::string posUpper = pos;
+        std::transform(posUpper.begin(), posUpper.end(), posUpper.begin(), ::toupper);
+        int index = positionIndex(posUpper);
+        // An unknown position matches nobody
+        if (index != -1) {
+            positionMask |= 1u << index;
+        }
+    }
+    return *this;
+}
+
+PlayerQuery& PlayerQuery::jerseyIs(int jerseyNumber) {
+    filterJersey = true;
+    jersey = jerseyNumber;
+    return *this;
+}
+
+PlayerQuery& PlayerQuery::nameContains(const std::string& text) {
+    filterName = true;
+    nameText = text;
+    return *this;
+}
+
+PlayerQuery& PlayerQuery::where(PlayerStat stat, Compare op, double value) {
+    conditions.push_back(Condition{stat, op, value});
+    return *this;
+}
+
+PlayerQuery& PlayerQuery::orderBy(PlayerStat stat, bool descendingOrder) {
+    ordered = true;
+    orderStat = stat;
+    descending = descendingOrder;
+    return *this;
+}
+
+PlayerQuery& PlayerQuery::limit(size_t count) {
+    maxResults = count;
+    return *this;
+}
+
+bool PlayerQuery::hasPositionFilter() const {
+    return filterPositions;
+}
+
+bool PlayerQuery::allowsPosition(int positionIndex) const {
+    if (!filterPositions) {
+        return true;
+    }
+    return positionIndex >= 0 && (positionMask & (1u << positionIndex)) != 0;
+}
+
+bool PlayerQuery::hasJersey() const {
+    return filterJersey;
+}
+
+int PlayerQuery::getJersey() const {
+    return jersey;
+}
+
+bool PlayerQuery::hasName() const {
+    return filterName;
+}
+
+const std::string& PlayerQuery::getName() const {
+    return nameText;
+}
@@ -0,0 +1,145 @@
+#ifndef QUERY_H
+#define QUERY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Player.h"
+#include "TopK.h"
+
+enum class Compare {
+    Less,
+    LessEqual,
+    Equal,
+    GreaterEqual,
+    Greater
+};
+
+// A filter, ordering and limit over players, built with chained setters:
+//
+//     PlayerQuery().positionIn({"PF", "C"})
+//                  .where(PlayerStat::Age, Compare::Less, 27)
+//                  .where(PlayerStat::Rebounds, Compare::GreaterEqual, 8)
+//                  .orderBy(PlayerStat::Assists).limit(5)
+//
+// Roster::select and League::select run it. They start from the narrowest
+// index the query allows (jersey, name, position) and scan the rest one
+// condition at a time over the shrinking candidate list. That scan is scalar
+// over the row-wise players or records, with the comparison resolved once per
+// pass; the SIMD kernels in Stats.h work on PlayerTable columns, and building
+// one per query would cost more than the scan it replaces.
+class PlayerQuery {
+public:
+    struct Condition {
+        PlayerStat stat;
+        Compare op;
+        double value;
+    };
+
+private:
+    bool filterPositions;
+    uint32_t positionMask;   // Bit i set when VALID_POSITIONS[i] is allowed
+    bool filterJersey;
+    int jersey;
+    bool filterName;
+    std::string nameText;
+    std::vector<Condition> conditions;
+    bool ordered;
+    PlayerStat orderStat;
+    bool descending;
+    size_t maxResults;
+
+public:
+    PlayerQuery();
+
+    // Filters; every one given must match
+    PlayerQuery& positionIn(const std::vector<std::string>& positions);
+    PlayerQuery& jerseyIs(int jerseyNumber);
+    PlayerQuery& nameContains(const std::string& text);   // Case-insensitive, like findByName
+    PlayerQuery& where(PlayerStat stat, Compare op, double value);
+
+    // Results come in roster order unless ordered; ties keep roster order
+    PlayerQuery& orderBy(PlayerStat stat, bool descendingOrder = true);
+    PlayerQuery& limit(size_t count);
+
+    bool hasPositionFilter() const;
+    bool allowsPosition(int positionIndex) const;
+    bool hasJersey() const;
+    int getJersey() const;
+    bool hasName() const;
+    const std::string& getName() const;
+
+    // Drops the ids whose stats fail a condition, one condition per pass.
+    // statOf(id, stat) returns the stat for an id.
+    template <typename Id, typename StatFn>
+    void applyConditions(std::vector<Id>& ids, StatFn statOf) const;
+
+    // Sorts by the order stat if there is one, then applies the limit
+    template <typename Id, typename StatFn>
+    void orderAndLimit(std::vector<Id>& ids, StatFn statOf) const;
+
+    // Keeps the ids for which keep(id) is true, preserving order
+    template <typename Id, typename Pred>
+    static void keepIf(std::vector<Id>& ids, Pred keep);
+};
+
+template <typename Id, typename Pred>
+void PlayerQuery::keepIf(std::vector<Id>& ids, Pred keep) {
+    size_t kept = 0;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (keep(ids[i])) {
+            ids[kept++] = ids[i];
+        }
+    }
+    ids.resize(kept);
+}
+
+template <typename Id, typename StatFn>
+void PlayerQuery::applyConditions(std::vector<Id>& ids, StatFn statOf) const {
+    for (const Condition& c : conditions) {
+        if (ids.empty()) {
+            return;
+        }
+        // Resolve the comparison once per pass rather than once per id
+        switch (c.op) {
+            case Compare::Less:
+                keepIf(ids, [&](Id id) { return statOf(id, c.stat) < c.value; });
+                break;
+            case Compare::LessEqual:
+                keepIf(ids, [&](Id id) { return statOf(id, c.stat) <= c.value; });
+                break;
+            case Compare::Equal:
+                keepIf(ids, [&](Id id) { return statOf(id, c.stat) == c.value; });
+                break;
+            case Compare::GreaterEqual:
+                keepIf(ids, [&](Id id) { return statOf(id, c.stat) >= c.value; });
+                break;
+            case Compare::Greater:
+                keepIf(ids, [&](Id id) { return statOf(id, c.stat) > c.value; });
+                break;
+        }
+    }
+}
+
+template <typename Id, typename StatFn>
+void PlayerQuery::orderAndLimit(std::vector<Id>& ids, StatFn statOf) const {
+    if (!ordered) {
+        if (ids.size() > maxResults) {
+            ids.resize(maxResults);
+        }
+        return;
+    }
+    double sign = descending ? 1.0 : -1.0;
+    std::vector<size_t> ranked = topKBy(ids.size(), maxResults, [&](size_t i) {
+        return sign * statOf(ids[i], orderStat);
+    });
+    std::vector<Id> result;
+    result.reserve(ranked.size());
+    for (size_t i : ranked) {
+        result.push_back(ids[i]);
+    }
+    ids.swap(result);
+}
+
+#endif // QUERY_H
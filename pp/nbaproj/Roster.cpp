@@ -1,33 +1,149 @@
 #include "Roster.h"
 #include "InputValidator.h"
+#include "Journal.h"
+#include "TextBuffer.h"
+#include "TopK.h"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
+#include <numeric>
 
-Roster::Roster(const std::string& name) 
-    : teamName(name), unsavedChanges(false) {}
+Roster::Roster(const std::string& name, int rosterSizeCap) 
+    : teamName(name), maxRosterSize(rosterSizeCap), unsavedChanges(false),
+      jerseySlots(MAX_JERSEY - MIN_JERSEY + 1, -1), hasDuplicateJerseys(false), positionBuckets(VALID_POSITIONS.size()),
+      journal(nullptr) {}
+
+int Roster::slotOf(int jerseyNumber) const {
+    if (jerseyNumber >= MIN_JERSEY && jerseyNumber <= MAX_JERSEY) {
+        return jerseySlots[jerseyNumber - MIN_JERSEY];
+    }
+    // Out-of-range numbers can only come from hand-edited files; fall back to a scan
+    for (size_t i = 0; i < players.size(); ++i) {
+        if (players[i].jerseyNumber == jerseyNumber) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void Roster::rebuildJerseyIndex() {
+    std::fill(jerseySlots.begin(), jerseySlots.end(), -1);
+    hasDuplicateJerseys = false;
+    for (size_t i = 0; i < players.size(); ++i) {
+        int jersey = players[i].jerseyNumber;
+        if (jersey < MIN_JERSEY || jersey > MAX_JERSEY) continue;
+        // Keep the first occurrence so duplicates in a loaded file resolve as before
+        int& slot = jerseySlots[jersey - MIN_JERSEY];
+        if (slot == -1) {
+            slot = static_cast<int>(i);
+        } else {
+            hasDuplicateJerseys = true;
+        }
+    }
+}
+
+void Roster::rebuildNameIndex() {
+    nameIndex.clear();
+    fuzzyNames.clear();
+    nameIndex.reserve(players.size(), players.size() * 16);
+    for (size_t i = 0; i < players.size(); ++i) {
+        nameIndex.insert(static_cast<uint32_t>(i), players[i].firstName, players[i].lastName);
+        fuzzyNames.insert(static_cast<uint32_t>(i), players[i].firstName, players[i].lastName);
+    }
+}
+
+void Roster::rebuildPositionIndex() {
+    for (auto& bucket : positionBuckets) {
+        bucket.clear();
+    }
+    for (size_t i = 0; i < players.size(); ++i) {
+        int pos = positionIndex(players[i].position);
+        if (pos != -1) {
+            positionBuckets[pos].push_back(static_cast<int>(i));
+        }
+    }
+}
+
+const std::vector<int>* Roster::positionBucket(const std::string& pos) const {
+    int index = positionIndex(pos);
+    return index == -1 ? nullptr : &positionBuckets[index];
+}
 
 bool Roster::addPlayer(const Player& p) {
-    if (players.size() >= static_cast<size_t>(MAX_ROSTER_SIZE)) {
+    if (getSize() >= maxRosterSize) {
         return false;
     }
     if (isJerseyTaken(p.jerseyNumber)) {
         return false;
     }
     players.push_back(p);
+    if (p.jerseyNumber >= MIN_JERSEY && p.jerseyNumber <= MAX_JERSEY) {
+        jerseySlots[p.jerseyNumber - MIN_JERSEY] = static_cast<int>(players.size() - 1);
+    }
+    nameIndex.insert(static_cast<uint32_t>(players.size() - 1), p.firstName, p.lastName);
+    fuzzyNames.insert(static_cast<uint32_t>(players.size() - 1), p.firstName, p.lastName);
+    int pos = positionIndex(p.position);
+    if (pos != -1) {
+        positionBuckets[pos].push_back(static_cast<int>(players.size() - 1));
+    }
+    if (journal != nullptr) {
+        journal->recordAdd(p);
+    }
     unsavedChanges = true;
     return true;
 }
 
 bool Roster::removePlayer(int jerseyNumber) {
-    for (auto it = players.begin(); it != players.end(); ++it) {
-        if (it->jerseyNumber == jerseyNumber) {
-            players.erase(it);
-            unsavedChanges = true;
-            return true;
+    int index = slotOf(jerseyNumber);
+    if (index == -1) {
+        return false;
+    }
+    
+    // Swap-remove, as League does: the last player fills the gap, so only
+    // their index entries move instead of those of everyone after the gap
+    int last = getSize() - 1;
+    int pos = positionIndex(players[index].position);
+    if (pos != -1) {
+        std::vector<int>& bucket = positionBuckets[pos];
+        bucket.erase(std::lower_bound(bucket.begin(), bucket.end(), index));
+    }
+    nameIndex.remove(static_cast<uint32_t>(index));
+    fuzzyNames.remove(static_cast<uint32_t>(index));
+    if (index != last) {
+        Player& moved = players[last];
+        int movedPos = positionIndex(moved.position);
+        if (movedPos != -1) {
+            std::vector<int>& bucket = positionBuckets[movedPos];
+            bucket.pop_back();   // `last` is the highest index in any bucket
+            bucket.insert(std::lower_bound(bucket.begin(), bucket.end(), index), index);
         }
+        nameIndex.remove(static_cast<uint32_t>(last));
+        nameIndex.insert(static_cast<uint32_t>(index), moved.firstName, moved.lastName);
+        fuzzyNames.remove(static_cast<uint32_t>(last));
+        fuzzyNames.insert(static_cast<uint32_t>(index), moved.firstName, moved.lastName);
+        players[index] = std::move(moved);
     }
-    return false;
+    players.pop_back();
+    
+    if (hasDuplicateJerseys) {
+        // A second owner of the number may now take the slot; rare enough to rescan
+        rebuildJerseyIndex();
+    } else {
+        if (jerseyNumber >= MIN_JERSEY && jerseyNumber <= MAX_JERSEY) {
+            jerseySlots[jerseyNumber - MIN_JERSEY] = -1;
+        }
+        if (index != last) {
+            int movedJersey = players[index].jerseyNumber;
+            if (movedJersey >= MIN_JERSEY && movedJersey <= MAX_JERSEY) {
+                jerseySlots[movedJersey - MIN_JERSEY] = index;
+            }
+        }
+    }
+    if (journal != nullptr) {
+        journal->recordRemove(jerseyNumber);
+    }
+    unsavedChanges = true;
+    return true;
 }
 
 bool Roster::editPlayer(int jerseyNumber, const Player& updatedPlayer) {
@@ -38,83 +154,340 @@ bool Roster::editPlayer(int jerseyNumber, const Player& updatedPlayer) {
         }
     }
     
-    for (auto& player : players) {
-        if (player.jerseyNumber == jerseyNumber) {
-            player = updatedPlayer;
-            unsavedChanges = true;
-            return true;
+    int index = slotOf(jerseyNumber);
+    if (index == -1) {
+        return false;
+    }
+    bool renamed = players[index].firstName != updatedPlayer.firstName ||
+                   players[index].lastName != updatedPlayer.lastName;
+    int oldPos = positionIndex(players[index].position);
+    int newPos = positionIndex(updatedPlayer.position);
+    if (oldPos != newPos) {
+        if (oldPos != -1) {
+            std::vector<int>& bucket = positionBuckets[oldPos];
+            bucket.erase(std::find(bucket.begin(), bucket.end(), index));
+        }
+        if (newPos != -1) {
+            std::vector<int>& bucket = positionBuckets[newPos];
+            bucket.insert(std::lower_bound(bucket.begin(), bucket.end(), index), index);
         }
     }
-    return false;
+    players[index] = updatedPlayer;
+    if (updatedPlayer.jerseyNumber != jerseyNumber) {
+        rebuildJerseyIndex();
+    }
+    if (renamed) {
+        nameIndex.insert(static_cast<uint32_t>(index), updatedPlayer.firstName, updatedPlayer.lastName);
+        fuzzyNames.insert(static_cast<uint32_t>(index), updatedPlayer.firstName, updatedPlayer.lastName);
+    }
+    if (journal != nullptr) {
+        journal->recordEdit(jerseyNumber, updatedPlayer);
+    }
+    unsavedChanges = true;
+    return true;
 }
 
-Player* Roster::findByJersey(int jerseyNumber) {
-    for (auto& player : players) {
-        if (player.jerseyNumber == jerseyNumber) {
-            return &player;
+bool Roster::apply(const RosterBatch& batch, size_t* failedOp) {
+    const std::vector<RosterBatch::Op>& ops = batch.getOps();
+    if (ops.empty()) {
+        return true;
+    }
+    
+    // Check against copies so a rejected batch leaves the roster untouched
+    std::vector<Player> next(players);
+    std::vector<bool> removed(players.size(), false);
+    std::vector<int> slots(jerseySlots);
+    int live = static_cast<int>(players.size());
+    
+    // Duplicate numbers only come from hand-edited files. Without them, freeing
+    // a number never uncovers another player who holds it.
+    size_t inRange = std::count_if(players.begin(), players.end(), [](const Player& p) {
+        return p.jerseyNumber >= MIN_JERSEY && p.jerseyNumber <= MAX_JERSEY;
+    });
+    bool duplicates = inRange > static_cast<size_t>(std::count_if(slots.begin(), slots.end(),
+                                                                  [](int slot) { return slot != -1; }));
+    
+    auto holderOf = [&](int jersey) {
+        for (size_t i = 0; i < next.size(); ++i) {
+            if (!removed[i] && next[i].jerseyNumber == jersey) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    };
+    auto find = [&](int jersey) {
+        if (jersey >= MIN_JERSEY && jersey <= MAX_JERSEY) {
+            return slots[jersey - MIN_JERSEY];
+        }
+        return holderOf(jersey);
+    };
+    auto claim = [&](int jersey, int index) {
+        if (jersey >= MIN_JERSEY && jersey <= MAX_JERSEY) {
+            slots[jersey - MIN_JERSEY] = index;
+        }
+    };
+    auto release = [&](int jersey) {
+        if (jersey >= MIN_JERSEY && jersey <= MAX_JERSEY) {
+            slots[jersey - MIN_JERSEY] = duplicates ? holderOf(jersey) : -1;
+        }
+    };
+    
+    for (size_t i = 0; i < ops.size(); ++i) {
+        const RosterBatch::Op& op = ops[i];
+        bool accepted = false;
+        switch (op.kind) {
+            case RosterBatch::OpKind::Add:
+                if (find(op.player.jerseyNumber) == -1) {
+                    next.push_back(op.player);
+                    removed.push_back(false);
+                    claim(op.player.jerseyNumber, static_cast<int>(next.size() - 1));
+                    live++;
+                    accepted = true;
+                }
+                break;
+            case RosterBatch::OpKind::Remove: {
+                int index = find(op.jerseyNumber);
+                if (index != -1) {
+                    removed[index] = true;
+                    release(op.jerseyNumber);
+                    live--;
+                    accepted = true;
+                }
+                break;
+            }
+            case RosterBatch::OpKind::Edit: {
+                int newJersey = op.player.jerseyNumber;
+                int index = find(op.jerseyNumber);
+                if (index == -1 || (newJersey != op.jerseyNumber && find(newJersey) != -1)) {
+                    break;
+                }
+                next[index] = op.player;
+                if (newJersey != op.jerseyNumber) {
+                    release(op.jerseyNumber);
+                    claim(newJersey, index);
+                }
+                accepted = true;
+                break;
+            }
+        }
+        if (!accepted) {
+            if (failedOp != nullptr) {
+                *failedOp = i;
+            }
+            return false;
+        }
+    }
+    
+    // The cap applies to the result; a roster loaded over it may still be edited
+    if (live > maxRosterSize && live > getSize()) {
+        if (failedOp != nullptr) {
+            *failedOp = ops.size();
+        }
+        return false;
+    }
+    
+    // Commit: drop removed players, then rebuild each index once
+    size_t kept = 0;
+    for (size_t i = 0; i < next.size(); ++i) {
+        if (!removed[i]) {
+            if (kept != i) {
+                next[kept] = std::move(next[i]);
+            }
+            kept++;
+        }
+    }
+    next.resize(kept);
+    players = std::move(next);
+    rebuildJerseyIndex();
+    rebuildNameIndex();
+    rebuildPositionIndex();
+    
+    if (journal != nullptr) {
+        for (const RosterBatch::Op& op : ops) {
+            switch (op.kind) {
+                case RosterBatch::OpKind::Add: journal->recordAdd(op.player); break;
+                case RosterBatch::OpKind::Remove: journal->recordRemove(op.jerseyNumber); break;
+                case RosterBatch::OpKind::Edit: journal->recordEdit(op.jerseyNumber, op.player); break;
+            }
         }
     }
-    return nullptr;
+    unsavedChanges = true;
+    return true;
+}
+
+Player* Roster::findByJersey(int jerseyNumber) {
+    int index = slotOf(jerseyNumber);
+    return index == -1 ? nullptr : &players[index];
 }
 
 const Player* Roster::findByJersey(int jerseyNumber) const {
-    for (const auto& player : players) {
-        if (player.jerseyNumber == jerseyNumber) {
-            return &player;
-        }
-    }
-    return nullptr;
+    int index = slotOf(jerseyNumber);
+    return index == -1 ? nullptr : &players[index];
 }
 
 std::vector<Player> Roster::findByName(const std::string& name) const {
-    std::vector<Player> results;
-    std::string searchLower = name;
-    std::transform(searchLower.begin(), searchLower.end(), searchLower.begin(), ::tolower);
-    
-    for (const auto& player : players) {
-        std::string fullName = player.firstName + " " + player.lastName;
-        std::string fullNameLower = fullName;
-        std::transform(fullNameLower.begin(), fullNameLower.end(), fullNameLower.begin(), ::tolower);
-        
-        if (fullNameLower.find(searchLower) != std::string::npos) {
-            results.push_back(player);
-        }
+    PlayerRange matches = viewByName(name);
+    return std::vector<Player>(matches.begin(), matches.end());
+}
+
+PlayerRange Roster::viewByName(const std::string& name) const {
+    NameSearch search;
+    nameIndex.find(name, search);
+    return PlayerRange(players.data(), std::move(search.results));
+}
+
+PlayerRange Roster::viewByName(const std::string& name, NameSearch& search) const {
+    nameIndex.find(name, search);
+    return PlayerRange(players.data(), search.results.data(), search.results.size());
+}
+
+std::vector<const Player*> Roster::findByNameFuzzy(const std::string& name, size_t limit) const {
+    std::vector<const Player*> results;
+    for (const FuzzyMatch& match :
+         fuzzyNames.search(name, FuzzyNameIndex::defaultMaxDistance(name), limit)) {
+        results.push_back(&players[match.id]);
     }
     return results;
 }
 
 std::vector<Player> Roster::findByPosition(const std::string& pos) const {
-    std::vector<Player> results;
+    PlayerRange matches = viewByPosition(pos);
+    return std::vector<Player>(matches.begin(), matches.end());
+}
+
+PlayerRange Roster::viewByPosition(const std::string& pos) const {
     std::string posUpper = pos;
     std::transform(posUpper.begin(), posUpper.end(), posUpper.begin(), ::toupper);
     
-    for (const auto& player : players) {
-        if (player.position == posUpper) {
-            results.push_back(player);
+    // Valid positions borrow their bucket outright
+    const std::vector<int>* bucket = positionBucket(posUpper);
+    if (bucket != nullptr) {
+        return PlayerRange(players.data(), bucket->data(), bucket->size());
+    }
+    std::vector<int> ids;
+    for (size_t i = 0; i < players.size(); ++i) {
+        if (players[i].position == posUpper) {
+            ids.push_back(static_cast<int>(i));
         }
     }
-    return results;
+    return PlayerRange(players.data(), std::move(ids));
+}
+
+int Roster::countAtPosition(const std::string& pos) const {
+    const std::vector<int>* bucket = positionBucket(pos);
+    if (bucket != nullptr) {
+        return static_cast<int>(bucket->size());
+    }
+    int count = 0;
+    forEachAtPosition(pos, [&](const Player&) { count++; });
+    return count;
+}
+
+std::vector<int> Roster::select(const PlayerQuery& query) const {
+    std::vector<int> ids;
+    
+    // Start from the narrowest index the query allows
+    if (query.hasJersey()) {
+        int slot = slotOf(query.getJersey());
+        if (slot != -1) {
+            ids.push_back(slot);
+        }
+    } else if (query.hasName()) {
+        for (uint32_t index : nameIndex.find(query.getName())) {
+            ids.push_back(static_cast<int>(index));
+        }
+    } else if (query.hasPositionFilter()) {
+        for (size_t i = 0; i < positionBuckets.size(); ++i) {
+            if (query.allowsPosition(static_cast<int>(i))) {
+                ids.insert(ids.end(), positionBuckets[i].begin(), positionBuckets[i].end());
+            }
+        }
+        std::sort(ids.begin(), ids.end());
+    } else {
+        ids.resize(players.size());
+        std::iota(ids.begin(), ids.end(), 0);
+    }
+    
+    // Then check whatever the starting index did not cover
+    if (query.hasJersey() && query.hasName()) {
+        std::vector<uint32_t> named = nameIndex.find(query.getName());
+        PlayerQuery::keepIf(ids, [&](int i) {
+            return std::binary_search(named.begin(), named.end(), static_cast<uint32_t>(i));
+        });
+    }
+    if (query.hasPositionFilter() && (query.hasJersey() || query.hasName())) {
+        PlayerQuery::keepIf(ids, [&](int i) {
+            return query.allowsPosition(positionIndex(players[i].position));
+        });
+    }
+    auto statOf = [&](int i, PlayerStat stat) { return statValue(players[i], stat); };
+    query.applyConditions(ids, statOf);
+    query.orderAndLimit(ids, statOf);
+    return ids;
 }
 
 bool Roster::isJerseyTaken(int jerseyNumber) const {
     return findByJersey(jerseyNumber) != nullptr;
 }
 
+std::vector<const Player*> Roster::topPlayers(PlayerStat stat, size_t k) const {
+    std::vector<const Player*> results;
+    for (size_t index : topKBy(players.size(), k,
+                               [&](size_t i) { return statValue(players[i], stat); })) {
+        results.push_back(&players[index]);
+    }
+    return results;
+}
+
+std::vector<const Player*> Roster::topPlayers(const StatWeights& weights, size_t k) const {
+    std::vector<const Player*> results;
+    for (size_t index : topKBy(players.size(), k,
+                               [&](size_t i) { return compositeValue(players[i], weights); })) {
+        results.push_back(&players[index]);
+    }
+    return results;
+}
+
+namespace {
+
+const size_t ROW_BYTES = 82;   // One table line with its newline, for sizing buffers
+const std::string_view DOUBLE_RULE =
+    "================================================================================\n";
+const std::string_view SINGLE_RULE =
+    "--------------------------------------------------------------------------------\n";
+
+// Team name right-aligned in 50 columns, then the title and 30 spaces of padding
+void appendTitle(TextBuffer& out, const std::string& teamName, std::string_view title) {
+    out.padLeft(teamName, 50).append(title).append(' ', 30).append('\n');
+}
+
+} // namespace
+
+void Roster::appendRosterHeader(TextBuffer& out) const {
+    out.append('\n').append(DOUBLE_RULE);
+    appendTitle(out, teamName, " ROSTER");
+    out.append(DOUBLE_RULE);
+    out.append("  #   | Name                 | Pos | Height | Wt  |  PPG  |  RPG  |  APG  |\n");
+    out.append(SINGLE_RULE);
+}
+
+void Roster::appendRosterFooter(TextBuffer& out) const {
+    out.append(SINGLE_RULE);
+    out.padLeft("Players: ", 35).appendInt(getSize()).append('/').appendInt(maxRosterSize)
+       .append(" | Available Slots: ").appendInt(getRemainingSlots()).append('\n');
+    out.append(DOUBLE_RULE);
+}
+
 void Roster::displayRosterHeader() const {
-    std::cout << "\n";
-    std::cout << std::string(80, '=') << "\n";
-    std::cout << std::setw(50) << std::right << teamName << " ROSTER" 
-              << std::setw(30) << "" << "\n";
-    std::cout << std::string(80, '=') << "\n";
-    std::cout << "  #   | Name                 | Pos | Height | Wt  |  PPG  |  RPG  |  APG  |\n";
-    std::cout << std::string(80, '-') << "\n";
+    TextBuffer out;
+    appendRosterHeader(out);
+    out.flush(std::cout);
 }
 
 void Roster::displayRosterFooter() const {
-    std::cout << std::string(80, '-') << "\n";
-    std::cout << std::setw(35) << "Players: " << getSize() << "/" << MAX_ROSTER_SIZE
-              << " | Available Slots: " << getRemainingSlots() << "\n";
-    std::cout << std::string(80, '=') << "\n";
+    TextBuffer out;
+    appendRosterFooter(out);
+    out.flush(std::cout);
 }
 
 void Roster::displayAll() const {
@@ -123,11 +496,16 @@ void Roster::displayAll() const {
         return;
     }
     
-    displayRosterHeader();
+    // Render the whole table into one buffer and write it once
+    TextBuffer out;
+    out.reserve((players.size() + 10) * ROW_BYTES);
+    appendRosterHeader(out);
     for (const auto& player : players) {
-        std::cout << formatPlayerRow(player) << "\n";
+        appendPlayerRow(out, player);
+        out.append('\n');
     }
-    displayRosterFooter();
+    appendRosterFooter(out);
+    out.flush(std::cout);
 }
 
 void Roster::displayByPosition() const {
@@ -136,22 +514,26 @@ void Roster::displayByPosition() const {
         return;
     }
     
-    std::cout << "\n" << std::string(80, '=') << "\n";
-    std::cout << std::setw(50) << std::right << teamName << " - BY POSITION" 
-              << std::setw(30) << "" << "\n";
-    std::cout << std::string(80, '=') << "\n";
+    TextBuffer out;
+    out.reserve((players.size() + 4 * VALID_POSITIONS.size()) * ROW_BYTES);
+    out.append('\n').append(DOUBLE_RULE);
+    appendTitle(out, teamName, " - BY POSITION");
+    out.append(DOUBLE_RULE);
     
-    for (const auto& pos : VALID_POSITIONS) {
-        std::vector<Player> posPlayers = findByPosition(pos);
-        if (!posPlayers.empty()) {
-            std::cout << "\n  " << pos << ":\n";
-            std::cout << std::string(78, '-') << "\n";
-            for (const auto& player : posPlayers) {
-                std::cout << "  " << formatPlayerRow(player) << "\n";
+    // One pass over the buckets; every player is visited once and never copied
+    for (size_t i = 0; i < VALID_POSITIONS.size(); ++i) {
+        if (!positionBuckets[i].empty()) {
+            out.append("\n  ").append(VALID_POSITIONS[i]).append(":\n");
+            out.append(SINGLE_RULE.substr(2));
+            for (int index : positionBuckets[i]) {
+                out.append("  ");
+                appendPlayerRow(out, players[index]);
+                out.append('\n');
             }
         }
     }
-    std::cout << std::string(80, '=') << "\n";
+    out.append(DOUBLE_RULE);
+    out.flush(std::cout);
 }
 
 void Roster::displayStats() const {
@@ -160,32 +542,30 @@ void Roster::displayStats() const {
         return;
     }
     
-    // Create sorted copy by PPG descending
-    std::vector<Player> sorted = players;
-    std::sort(sorted.begin(), sorted.end(), 
-        [](const Player& a, const Player& b) {
-            return a.pointsPerGame > b.pointsPerGame;
-        });
+    // Rank by PPG descending without copying any players
+    std::vector<const Player*> ranked = topPlayers(PlayerStat::Points, players.size());
     
-    std::cout << "\n" << std::string(80, '=') << "\n";
-    std::cout << std::setw(50) << std::right << teamName << " - TOP SCORERS" 
-              << std::setw(30) << "" << "\n";
-    std::cout << std::string(80, '=') << "\n";
-    std::cout << "  Rank | Name                 | Pos |  PPG  |  RPG  |  APG  |\n";
-    std::cout << std::string(80, '-') << "\n";
+    TextBuffer out;
+    out.reserve((ranked.size() + 8) * ROW_BYTES);
+    out.append('\n').append(DOUBLE_RULE);
+    appendTitle(out, teamName, " - TOP SCORERS");
+    out.append(DOUBLE_RULE);
+    out.append("  Rank | Name                 | Pos |  PPG  |  RPG  |  APG  |\n");
+    out.append(SINGLE_RULE);
     
     int rank = 1;
-    for (const auto& player : sorted) {
-        std::cout << "  " << std::setw(4) << rank++ << " | "
-                  << std::left << std::setw(20) 
-                  << (player.lastName + ", " + player.firstName).substr(0, 20) << " | "
-                  << std::setw(3) << player.position << " | "
-                  << std::right << std::fixed << std::setprecision(1)
-                  << std::setw(5) << player.pointsPerGame << " | "
-                  << std::setw(5) << player.reboundsPerGame << " | "
-                  << std::setw(5) << player.assistsPerGame << " |\n";
+    for (const Player* player : ranked) {
+        out.append("  ").appendInt(rank++, 4).append(" | ");
+        appendNameColumn(out, *player);
+        out.append(" | ").padRight(player->position.str(), 3).append(" | ")
+           .appendFixed(player->pointsPerGame, 1, 5).append(" | ")
+           .appendFixed(player->reboundsPerGame, 1, 5).append(" | ")
+           .appendFixed(player->assistsPerGame, 1, 5).append(" |\n");
     }
-    std::cout << std::string(80, '=') << "\n";
+    out.append(DOUBLE_RULE);
+    out.flush(std::cout);
+    // The stream version left cout in this state and later prompts print with it
+    std::cout << std::right << std::fixed << std::setprecision(1);
 }
 
 int Roster::getSize() const {
@@ -193,7 +573,11 @@ int Roster::getSize() const {
 }
 
 int Roster::getRemainingSlots() const {
-    return MAX_ROSTER_SIZE - getSize();
+    return maxRosterSize - getSize();
+}
+
+int Roster::getRosterSizeCap() const {
+    return maxRosterSize;
 }
 
 bool Roster::hasUnsavedChanges() const {
@@ -206,6 +590,9 @@ std::string Roster::getTeamName() const {
 
 void Roster::setTeamName(const std::string& name) {
     teamName = name;
+    if (journal != nullptr) {
+        journal->recordTeamName(name);
+    }
     unsavedChanges = true;
 }
 
@@ -214,7 +601,15 @@ const std::vector<Player>& Roster::getPlayers() const {
 }
 
 void Roster::setPlayers(const std::vector<Player>& loadedPlayers) {
-    players = loadedPlayers;
+    setPlayers(std::vector<Player>(loadedPlayers));
+}
+
+void Roster::setPlayers(std::vector<Player>&& loadedPlayers) {
+    // Take the loader's buffer instead of copying it; the old one is freed here
+    players = std::move(loadedPlayers);
+    rebuildJerseyIndex();
+    rebuildNameIndex();
+    rebuildPositionIndex();
 }
 
 void Roster::markSaved() {
@@ -224,3 +619,11 @@ void Roster::markSaved() {
 void Roster::markChanged() {
     unsavedChanges = true;
 }
+
+void Roster::setJournal(RosterJournal* changeLog) {
+    journal = changeLog;
+}
+
+RosterJournal* Roster::getJournal() const {
+    return journal;
+}
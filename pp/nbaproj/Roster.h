@@ -4,29 +4,89 @@
 #include <vector>
 #include <string>
 #include "Player.h"
+#include "FuzzyNameIndex.h"
+#include "InputValidator.h"
+#include "NameIndex.h"
+#include "PlayerRange.h"
+#include "Query.h"
+#include "RosterBatch.h"
+
+class RosterJournal;
+class TextBuffer;
 
 class Roster {
 private:
     std::vector<Player> players;
     std::string teamName;
+    int maxRosterSize;
     bool unsavedChanges;
 
+    // Direct-mapped jersey index: jerseySlots[jersey - MIN_JERSEY] holds the
+    // player's position in `players`, or -1 when the number is free.
+    // hasDuplicateJerseys is set when a loaded file reused a number.
+    std::vector<int> jerseySlots;
+    bool hasDuplicateJerseys;
+
+    // Trigram index over "first last" names, keyed by position in `players`
+    NameIndex nameIndex;
+    FuzzyNameIndex fuzzyNames;
+
+    // positionBuckets[i] holds the positions in `players` of everyone at
+    // VALID_POSITIONS[i], in roster order
+    std::vector<std::vector<int>> positionBuckets;
+
+    RosterJournal* journal;   // Optional change log, not owned
+
+    int slotOf(int jerseyNumber) const;
+    void rebuildJerseyIndex();
+    void rebuildNameIndex();
+    void rebuildPositionIndex();
+    const std::vector<int>* positionBucket(const std::string& pos) const;
+    void appendRosterHeader(TextBuffer& out) const;
+    void appendRosterFooter(TextBuffer& out) const;
+
 public:
-    // Constructor
-    Roster(const std::string& name = "My Team");
+    // Constructor. The cap applies to addPlayer and apply; the jersey range
+    // keeps any valid roster at or under MAX_JERSEY - MIN_JERSEY + 1 players.
+    Roster(const std::string& name = "My Team", int rosterSizeCap = MAX_ROSTER_SIZE);
 
     // Core operations
     bool addPlayer(const Player& p);
-    bool removePlayer(int jerseyNumber);
+    bool removePlayer(int jerseyNumber);   // The last player takes the freed place
     bool editPlayer(int jerseyNumber, const Player& updatedPlayer);
+    // Applies every change in the batch or none of them; see RosterBatch.
+    // On failure *failedOp, if given, is the index of the first rejected op,
+    // or batch.size() when only the final roster size is over the cap.
+    bool apply(const RosterBatch& batch, size_t* failedOp = nullptr);
 
     // Query operations
+    // Jersey lookups are O(1). Change a player's jersey or name through
+    // editPlayer, never through the returned pointer, or the indexes go stale.
     Player* findByJersey(int jerseyNumber);
     const Player* findByJersey(int jerseyNumber) const;
-    std::vector<Player> findByName(const std::string& name) const;
+    std::vector<Player> findByName(const std::string& name) const;   // Indexed substring match
+    std::vector<const Player*> findByNameFuzzy(const std::string& name, size_t limit) const;
     std::vector<Player> findByPosition(const std::string& pos) const;
+    int countAtPosition(const std::string& pos) const;
+    // Same matches as findByName/findByPosition without copying any player;
+    // valid until the roster is next modified
+    PlayerRange viewByName(const std::string& name) const;
+    // Same, borrowing search.results: no allocation once `search` has grown
+    // to fit, and valid until `search` is reused too
+    PlayerRange viewByName(const std::string& name, NameSearch& search) const;
+    PlayerRange viewByPosition(const std::string& pos) const;
+    // Visits each player at `pos` (exact, uppercase) in roster order without copying
+    template <typename Visitor>
+    void forEachAtPosition(const std::string& pos, Visitor visit) const;
     bool isJerseyTaken(int jerseyNumber) const;
 
+    // Indices into getPlayers() matching the query, valid until the roster is next modified
+    std::vector<int> select(const PlayerQuery& query) const;
+
+    // Ranked results, best first. Pointers are valid until the roster is next modified.
+    std::vector<const Player*> topPlayers(PlayerStat stat, size_t k) const;
+    std::vector<const Player*> topPlayers(const StatWeights& weights, size_t k) const;
+
     // Display operations
     void displayAll() const;
     void displayByPosition() const;
@@ -37,15 +97,39 @@ public:
     // Roster info
     int getSize() const;
     int getRemainingSlots() const;
+    int getRosterSizeCap() const;
     bool hasUnsavedChanges() const;
     std::string getTeamName() const;
     void setTeamName(const std::string& name);
 
     // Data access for file operations
     const std::vector<Player>& getPlayers() const;
+    // Replaces every player; names only the old players used leave the pool
     void setPlayers(const std::vector<Player>& loadedPlayers);
+    void setPlayers(std::vector<Player>&& loadedPlayers);
     void markSaved();
     void markChanged();
+
+    // Successful changes are recorded to the attached journal, if any
+    void setJournal(RosterJournal* changeLog);
+    RosterJournal* getJournal() const;
 };
 
+template <typename Visitor>
+void Roster::forEachAtPosition(const std::string& pos, Visitor visit) const {
+    const std::vector<int>* bucket = positionBucket(pos);
+    if (bucket != nullptr) {
+        for (int index : *bucket) {
+            visit(players[index]);
+        }
+        return;
+    }
+    // Positions outside VALID_POSITIONS only come from hand-edited files
+    for (const auto& player : players) {
+        if (player.position == pos) {
+            visit(player);
+        }
+    }
+}
+
 #endif // ROSTER_H
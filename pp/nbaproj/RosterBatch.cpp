@@ -0,0 +1,36 @@
+#include "RosterBatch.h"
+
+RosterBatch& RosterBatch::add(const Player& p) {
+    ops.push_back(Op{OpKind::Add, p.jerseyNumber, p});
+    return *this;
+}
+
+RosterBatch& RosterBatch::remove(int jerseyNumber) {
+    ops.push_back(Op{OpKind::Remove, jerseyNumber, Player()});
+    return *this;
+}
+
+RosterBatch& RosterBatch::edit(int jerseyNumber, const Player& updatedPlayer) {
+    ops.push_back(Op{OpKind::Edit, jerseyNumber, updatedPlayer});
+    return *this;
+}
+
+void RosterBatch::reserve(size_t count) {
+    ops.reserve(count);
+}
+
+void RosterBatch::clear() {
+    ops.clear();
+}
+
+bool RosterBatch::empty() const {
+    return ops.empty();
+}
+
+size_t RosterBatch::size() const {
+    return ops.size();
+}
+
+const std::vector<RosterBatch::Op>& RosterBatch::getOps() const {
+    return ops;
+}
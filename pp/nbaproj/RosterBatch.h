@@ -0,0 +1,49 @@
+#ifndef ROSTERBATCH_H
+#define ROSTERBATCH_H
+
+#include <cstddef>
+#include <vector>
+#include "Player.h"
+
+// A list of roster changes applied all together or not at all:
+//
+//     RosterBatch trade;
+//     trade.remove(23).remove(11).add(incoming).edit(7, moved);
+//     roster.apply(trade);
+//
+// Roster::apply checks the operations in order against the roster as the
+// earlier ones leave it, with the same rules as addPlayer, removePlayer and
+// editPlayer. The only exception is the size cap, which applies to the final
+// roster, so a trade at full strength can list its additions first. If
+// every operation passes, the changes are committed with one rebuild of
+// each index.
+class RosterBatch {
+public:
+    enum class OpKind {
+        Add,
+        Remove,
+        Edit
+    };
+
+    struct Op {
+        OpKind kind;
+        int jerseyNumber;   // The player affected, as numbered before this op
+        Player player;      // New details for Add and Edit
+    };
+
+private:
+    std::vector<Op> ops;
+
+public:
+    RosterBatch& add(const Player& p);
+    RosterBatch& remove(int jerseyNumber);
+    RosterBatch& edit(int jerseyNumber, const Player& updatedPlayer);
+
+    void reserve(size_t count);
+    void clear();
+    bool empty() const;
+    size_t size() const;
+    const std::vector<Op>& getOps() const;
+};
+
+#endif // ROSTERBATCH_H
@@ -0,0 +1,577 @@
+#include "RosterFormats.h"
+#include "FileHandler.h"
+#include "InputValidator.h"
+#include "MappedFile.h"
+#include "TextBuffer.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <deque>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+const size_t COLUMN_COUNT = PLAYER_FIELD_COUNT + 1;
+const std::string_view COLUMNS[COLUMN_COUNT] = {
+    "team", "first_name", "last_name", "jersey", "position", "height_in",
+    "weight_lbs", "age", "ppg", "rpg", "apg"};
+const size_t TEAM_COLUMN = 0;      // Player fields follow in writePlayerRecord order
+const size_t NO_COLUMN = COLUMN_COUNT;
+// JSON type of each column: names and position are strings, the rest numbers
+const bool TEXT_COLUMN[COLUMN_COUNT] = {
+    true, true, true, false, true, false, false, false, false, false, false};
+
+const size_t FLUSH_BYTES = 1 << 20;
+const std::string_view UTF8_BOM = "\xEF\xBB\xBF";   // Spreadsheet exports often start with one
+
+// `expected` is checked first: writers emit the columns in order
+size_t columnIndex(std::string_view name, size_t expected = 0) {
+    if (expected < COLUMN_COUNT && COLUMNS[expected] == name) return expected;
+    for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+        if (COLUMNS[i] == name) return i;
+    }
+    return NO_COLUMN;
+}
+
+std::string missingColumnError(const char* what, size_t column) {
+    return std::string(what) + " '" + std::string(COLUMNS[column]) + "'";
+}
+
+// Writes `roster` one record at a time through a single reused buffer
+template <typename AppendRecord>
+void streamRoster(std::ostream& out, const Roster& roster, TextBuffer& buffer, AppendRecord appendRecord) {
+    for (const auto& p : roster.getPlayers()) {
+        appendRecord(buffer, p);
+        if (buffer.size() >= FLUSH_BYTES) {
+            buffer.flush(out);
+        }
+    }
+    buffer.flush(out);
+}
+
+// ----- CSV reading -----
+
+// Reads the record starting at `pos` and moves `pos` past its line ending.
+// `line` counts the newlines consumed, since quoted fields may span lines.
+// Fields are views into `text`, or into `scratch` when they held doubled
+// quotes. False on a stray or unterminated quote, with the rest of the line
+// skipped.
+bool readCsvRecord(std::string_view text, size_t& pos, size_t& line,
+                   std::vector<std::string_view>& fields, std::deque<std::string>& scratch) {
+    fields.clear();
+    size_t used = 0;
+    while (true) {
+        if (pos < text.size() && text[pos] == '"') {
+            size_t start = ++pos;
+            bool doubled = false;
+            size_t quote;
+            while (true) {
+                quote = text.find('"', pos);
+                if (quote == std::string_view::npos) {
+                    pos = text.size();
+                    return false;
+                }
+                line += static_cast<size_t>(std::count(text.begin() + pos, text.begin() + quote, '\n'));
+                if (quote + 1 < text.size() && text[quote + 1] == '"') {
+                    doubled = true;
+                    pos = quote + 2;
+                    continue;
+                }
+                break;
+            }
+            std::string_view raw = text.substr(start, quote - start);
+            pos = quote + 1;
+            if (doubled) {
+                if (used == scratch.size()) {
+                    scratch.emplace_back();
+                }
+                std::string& unquoted = scratch[used++];
+                unquoted.clear();
+                for (size_t i = 0; i < raw.size(); ++i) {
+                    unquoted += raw[i];
+                    if (raw[i] == '"') ++i;   // "" stands for one quote
+                }
+                fields.push_back(unquoted);
+            } else {
+                fields.push_back(raw);
+            }
+
+            // The closing quote must end the field
+            if (pos < text.size() && text[pos] == ',') {
+                pos++;
+                continue;
+            }
+            if (pos < text.size() && text[pos] == '\r' &&
+                (pos + 1 == text.size() || text[pos + 1] == '\n')) {
+                pos++;
+            }
+            if (pos >= text.size()) return true;
+            if (text[pos] == '\n') {
+                pos++;
+                line++;
+                return true;
+            }
+            size_t newline = text.find('\n', pos);
+            pos = newline == std::string_view::npos ? text.size() : newline + 1;
+            line++;
+            return false;
+        }
+
+        size_t end = text.find_first_of(",\n", pos);
+        std::string_view field = text.substr(pos, (end == std::string_view::npos ? text.size() : end) - pos);
+        if (end == std::string_view::npos || text[end] == '\n') {
+            if (!field.empty() && field.back() == '\r') {
+                field.remove_suffix(1);
+            }
+            fields.push_back(field);
+            if (end == std::string_view::npos) {
+                pos = text.size();
+            } else {
+                pos = end + 1;
+                line++;
+            }
+            return true;
+        }
+        fields.push_back(field);
+        pos = end + 1;
+    }
+}
+
+// ----- JSON reading -----
+
+size_t skipSpace(std::string_view text, size_t pos) {
+    while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\r')) {
+        pos++;
+    }
+    return pos;
+}
+
+bool readHex4(std::string_view text, size_t& pos, unsigned& code) {
+    if (pos + 4 > text.size()) return false;
+    auto parsed = std::from_chars(text.data() + pos, text.data() + pos + 4, code, 16);
+    if (parsed.ec != std::errc() || parsed.ptr != text.data() + pos + 4) return false;
+    pos += 4;
+    return true;
+}
+
+void appendUtf8(std::string& out, unsigned code) {
+    if (code < 0x80) {
+        out += static_cast<char>(code);
+    } else if (code < 0x800) {
+        out += static_cast<char>(0xC0 | (code >> 6));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    } else if (code < 0x10000) {
+        out += static_cast<char>(0xE0 | (code >> 12));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (code >> 18));
+        out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    }
+}
+
+// Reads the JSON string whose opening quote is at text[pos] and moves `pos`
+// past the closing one. Strings without escapes are returned in place.
+bool readJsonString(std::string_view text, size_t& pos, std::string_view& value, std::string& scratch) {
+    size_t start = ++pos;
+    size_t special = start;
+    while (special < text.size() && text[special] != '"' && text[special] != '\\') {
+        special++;
+    }
+    if (special == text.size()) return false;
+    if (text[special] == '"') {
+        value = text.substr(start, special - start);
+        pos = special + 1;
+        return true;
+    }
+
+    scratch.assign(text.data() + start, special - start);
+    pos = special;
+    while (pos < text.size()) {
+        char c = text[pos++];
+        if (c == '"') {
+            value = scratch;
+            return true;
+        }
+        if (c != '\\') {
+            scratch += c;
+            continue;
+        }
+        if (pos >= text.size()) return false;
+        switch (text[pos++]) {
+            case '"':  scratch += '"'; break;
+            case '\\': scratch += '\\'; break;
+            case '/':  scratch += '/'; break;
+            case 'b':  scratch += '\b'; break;
+            case 'f':  scratch += '\f'; break;
+            case 'n':  scratch += '\n'; break;
+            case 'r':  scratch += '\r'; break;
+            case 't':  scratch += '\t'; break;
+            case 'u': {
+                unsigned code;
+                if (!readHex4(text, pos, code)) return false;
+                if (code >= 0xDC00 && code < 0xE000) return false;
+                if (code >= 0xD800 && code < 0xDC00) {
+                    // High surrogate: the low half must follow as another \u escape
+                    unsigned low;
+                    if (text.substr(pos, 2) != "\\u") return false;
+                    pos += 2;
+                    if (!readHex4(text, pos, low) || low < 0xDC00 || low >= 0xE000) return false;
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                }
+                appendUtf8(scratch, code);
+                break;
+            }
+            default: return false;
+        }
+    }
+    return false;
+}
+
+// One flat JSON object per line: string, number or literal members only.
+// Values are views into the line, or into per-column scratch when escaped.
+// Known columns must have their JSON type: a quoted string for the text
+// columns, a bare number for the numeric ones, so `"first_name": null` is
+// an error rather than a player named null.
+class JsonRecordReader {
+private:
+    std::string scratch[COLUMN_COUNT + 1];   // Last one takes unknown keys
+    std::string keyScratch;
+
+public:
+    std::string_view values[COLUMN_COUNT];
+    bool present[COLUMN_COUNT];
+
+    // False with `error` set if the line is not such an object
+    bool parse(std::string_view line, std::string& error);
+};
+
+bool JsonRecordReader::parse(std::string_view line, std::string& error) {
+    std::fill(present, present + COLUMN_COUNT, false);
+    size_t pos = skipSpace(line, 0);
+    if (pos >= line.size() || line[pos] != '{') {
+        error = "not a JSON object";
+        return false;
+    }
+    pos = skipSpace(line, pos + 1);
+
+    size_t nextColumn = 0;
+    bool closed = pos < line.size() && line[pos] == '}';
+    if (closed) {
+        pos++;
+    }
+    while (!closed) {
+        std::string_view key;
+        if (pos >= line.size() || line[pos] != '"' || !readJsonString(line, pos, key, keyScratch)) {
+            error = "expected a quoted key at column " + std::to_string(pos + 1);
+            return false;
+        }
+        size_t column = columnIndex(key, nextColumn);
+        nextColumn = column + 1;
+        pos = skipSpace(line, pos);
+        if (pos >= line.size() || line[pos] != ':') {
+            error = "expected ':' at column " + std::to_string(pos + 1);
+            return false;
+        }
+        pos = skipSpace(line, pos + 1);
+
+        std::string_view value;
+        size_t valueStart = pos;
+        bool quoted = pos < line.size() && line[pos] == '"';
+        if (quoted) {
+            if (!readJsonString(line, pos, value, scratch[column])) {
+                error = "bad string at column " + std::to_string(valueStart + 1);
+                return false;
+            }
+        } else {
+            size_t end = pos;
+            while (end < line.size() && line[end] != ',' && line[end] != '}' &&
+                   line[end] != ' ' && line[end] != '\t' && line[end] != '\r') {
+                end++;
+            }
+            value = line.substr(pos, end - pos);
+            if (value.empty() || value[0] == '{' || value[0] == '[') {
+                error = "expected a string or number at column " + std::to_string(valueStart + 1);
+                return false;
+            }
+            pos = end;
+        }
+        if (column != NO_COLUMN) {
+            if (quoted != TEXT_COLUMN[column]) {
+                error = "'" + std::string(COLUMNS[column]) + "' must be a JSON " +
+                        (TEXT_COLUMN[column] ? "string" : "number") + " at column " +
+                        std::to_string(valueStart + 1);
+                return false;
+            }
+            values[column] = value;
+            present[column] = true;
+        }
+
+        pos = skipSpace(line, pos);
+        if (pos < line.size() && line[pos] == ',') {
+            pos = skipSpace(line, pos + 1);
+        } else if (pos < line.size() && line[pos] == '}') {
+            pos++;
+            closed = true;
+        } else {
+            error = "expected ',' or '}' at column " + std::to_string(pos + 1);
+            return false;
+        }
+    }
+
+    if (skipSpace(line, pos) != line.size()) {
+        error = "text after the closing '}'";
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+RosterFormat formatForFilename(const std::string& filename) {
+    size_t dot = filename.find_last_of("./\\");
+    if (dot == std::string::npos || filename[dot] != '.') {
+        return RosterFormat::Text;
+    }
+    std::string extension = filename.substr(dot + 1);
+    for (char& c : extension) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    if (extension == "csv") {
+        return RosterFormat::Csv;
+    }
+    if (extension == "ndjson" || extension == "jsonl" || extension == "json") {
+        return RosterFormat::Ndjson;
+    }
+    return RosterFormat::Text;
+}
+
+// ----- Writing -----
+
+void appendCsvField(TextBuffer& out, std::string_view field) {
+    if (field.find_first_of(",\"\r\n") == std::string_view::npos) {
+        out.append(field);
+        return;
+    }
+    out.append('"');
+    size_t start = 0;
+    size_t quote;
+    while ((quote = field.find('"', start)) != std::string_view::npos) {
+        out.append(field.substr(start, quote + 1 - start)).append('"');
+        start = quote + 1;
+    }
+    out.append(field.substr(start)).append('"');
+}
+
+void appendJsonString(TextBuffer& out, std::string_view text) {
+    out.append('"');
+    size_t start = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+        out.append(text.substr(start, i - start));
+        start = i + 1;
+        switch (c) {
+            case '"':  out.append("\\\""); break;
+            case '\\': out.append("\\\\"); break;
+            case '\n': out.append("\\n"); break;
+            case '\r': out.append("\\r"); break;
+            case '\t': out.append("\\t"); break;
+            default:
+                out.append("\\u00").appendInt(c >> 4, 0).append("0123456789abcdef"[c & 0xF]);
+                break;
+        }
+    }
+    out.append(text.substr(start)).append('"');
+}
+
+void appendCsvHeader(TextBuffer& out) {
+    for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+        if (i > 0) out.append(',');
+        out.append(COLUMNS[i]);
+    }
+    out.append('\n');
+}
+
+void appendPlayerCsv(TextBuffer& out, const Player& p, std::string_view teamField) {
+    out.append(teamField).append(',');
+    appendCsvField(out, p.firstName.str());
+    out.append(',');
+    appendCsvField(out, p.lastName.str());
+    out.append(',').appendInt(p.jerseyNumber).append(',');
+    appendCsvField(out, p.position.str());
+    out.append(',').appendInt(p.heightInches).append(',').appendInt(p.weightLbs)
+       .append(',').appendInt(p.age).append(',').appendShortest(p.pointsPerGame)
+       .append(',').appendShortest(p.reboundsPerGame).append(',').appendShortest(p.assistsPerGame)
+       .append('\n');
+}
+
+void appendPlayerJson(TextBuffer& out, const Player& p, std::string_view teamField) {
+    out.append("{\"team\":").append(teamField).append(",\"first_name\":");
+    appendJsonString(out, p.firstName.str());
+    out.append(",\"last_name\":");
+    appendJsonString(out, p.lastName.str());
+    out.append(",\"jersey\":").appendInt(p.jerseyNumber).append(",\"position\":");
+    appendJsonString(out, p.position.str());
+    out.append(",\"height_in\":").appendInt(p.heightInches)
+       .append(",\"weight_lbs\":").appendInt(p.weightLbs)
+       .append(",\"age\":").appendInt(p.age)
+       .append(",\"ppg\":").appendShortest(p.pointsPerGame)
+       .append(",\"rpg\":").appendShortest(p.reboundsPerGame)
+       .append(",\"apg\":").appendShortest(p.assistsPerGame)
+       .append("}\n");
+}
+
+void writeRosterCsv(std::ostream& out, const Roster& roster) {
+    TextBuffer team;
+    appendCsvField(team, roster.getTeamName());
+
+    TextBuffer buffer;
+    buffer.reserve(FLUSH_BYTES + 1024);
+    appendCsvHeader(buffer);
+    streamRoster(out, roster, buffer, [&](TextBuffer& row, const Player& p) {
+        appendPlayerCsv(row, p, team.str());
+    });
+}
+
+void writeRosterNdjson(std::ostream& out, const Roster& roster) {
+    TextBuffer team;
+    appendJsonString(team, roster.getTeamName());
+
+    TextBuffer buffer;
+    buffer.reserve(FLUSH_BYTES + 1024);
+    streamRoster(out, roster, buffer, [&](TextBuffer& row, const Player& p) {
+        appendPlayerJson(row, p, team.str());
+    });
+}
+
+bool exportRoster(const Roster& roster, const std::string& filename, RosterFormat format) {
+    switch (format) {
+        case RosterFormat::Csv:
+            return writeFileAtomically(filename, [&](std::ostream& out) { writeRosterCsv(out, roster); });
+        case RosterFormat::Ndjson:
+            return writeFileAtomically(filename, [&](std::ostream& out) { writeRosterNdjson(out, roster); });
+        case RosterFormat::Text:
+            break;
+    }
+    return saveRoster(roster, filename);
+}
+
+// ----- Reading -----
+
+void importRosterCsv(Roster& roster, std::string_view text, ImportReport& report,
+                     const ImportOptions& options) {
+    RosterImporter importer(roster, report, options);
+    std::vector<std::string_view> fields;
+    std::deque<std::string> scratch;
+    size_t fieldOf[COLUMN_COUNT];   // Column -> position in the record
+    size_t headerSize = 0;
+
+    size_t pos = text.substr(0, UTF8_BOM.size()) == UTF8_BOM ? UTF8_BOM.size() : 0;
+    size_t line = 1;
+    while (pos < text.size()) {
+        size_t recordLine = line;
+        if (!readCsvRecord(text, pos, line, fields, scratch)) {
+            importer.addError(recordLine, "unterminated or misplaced quote");
+            continue;
+        }
+        if (fields.size() == 1 && fields[0].empty()) continue;
+
+        // The first record names the columns, in any order
+        if (headerSize == 0) {
+            std::fill(fieldOf, fieldOf + COLUMN_COUNT, NO_COLUMN);
+            for (size_t i = 0; i < fields.size(); ++i) {
+                size_t column = columnIndex(trimView(fields[i]));
+                if (column != NO_COLUMN) {
+                    fieldOf[column] = i;
+                }
+            }
+            for (size_t column = TEAM_COLUMN + 1; column < COLUMN_COUNT; ++column) {
+                if (fieldOf[column] == NO_COLUMN) {
+                    importer.addError(recordLine, missingColumnError("header has no column", column));
+                    importer.finish();
+                    return;
+                }
+            }
+            headerSize = fields.size();
+            continue;
+        }
+
+        if (fields.size() != headerSize) {
+            importer.addError(recordLine, "expected " + std::to_string(headerSize) + " fields, found " +
+                                          std::to_string(fields.size()));
+            continue;
+        }
+        if (!report.hasTeamName && fieldOf[TEAM_COLUMN] != NO_COLUMN) {
+            std::string_view team = fields[fieldOf[TEAM_COLUMN]];
+            report.teamName.assign(team.data(), team.size());
+            report.hasTeamName = true;
+        }
+        std::string_view player[PLAYER_FIELD_COUNT];
+        for (size_t i = 0; i < PLAYER_FIELD_COUNT; ++i) {
+            player[i] = fields[fieldOf[TEAM_COLUMN + 1 + i]];
+        }
+        importer.addFields(recordLine, player, PLAYER_FIELD_COUNT);
+    }
+    importer.finish();
+}
+
+void importRosterNdjson(Roster& roster, std::string_view text, ImportReport& report,
+                        const ImportOptions& options) {
+    RosterImporter importer(roster, report, options);
+    JsonRecordReader reader;
+    std::string error;
+
+    size_t lineNumber = 0;
+    size_t start = text.substr(0, UTF8_BOM.size()) == UTF8_BOM ? UTF8_BOM.size() : 0;
+    while (start < text.size()) {
+        size_t newline = text.find('\n', start);
+        if (newline == std::string_view::npos) {
+            newline = text.size();
+        }
+        std::string_view line = text.substr(start, newline - start);
+        start = newline + 1;
+        lineNumber++;
+
+        if (skipSpace(line, 0) == line.size()) continue;
+        if (!reader.parse(line, error)) {
+            importer.addError(lineNumber, error);
+            continue;
+        }
+
+        size_t missing = TEAM_COLUMN + 1;
+        while (missing < COLUMN_COUNT && reader.present[missing]) {
+            missing++;
+        }
+        if (missing < COLUMN_COUNT) {
+            importer.addError(lineNumber, missingColumnError("missing field", missing));
+            continue;
+        }
+        if (!report.hasTeamName && reader.present[TEAM_COLUMN]) {
+            std::string_view team = reader.values[TEAM_COLUMN];
+            report.teamName.assign(team.data(), team.size());
+            report.hasTeamName = true;
+        }
+        importer.addFields(lineNumber, reader.values + TEAM_COLUMN + 1, PLAYER_FIELD_COUNT);
+    }
+    importer.finish();
+}
+
+bool importRosterFile(Roster& roster, const std::string& filename, RosterFormat format,
+                      ImportReport& report, const ImportOptions& options) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        std::cerr << "  Error: Could not open file for reading.\n";
+        return false;
+    }
+    switch (format) {
+        case RosterFormat::Csv:    importRosterCsv(roster, file.view(), report, options); break;
+        case RosterFormat::Ndjson: importRosterNdjson(roster, file.view(), report, options); break;
+        case RosterFormat::Text:   importRosterText(roster, file.view(), report, options); break;
+    }
+    return true;
+}
@@ -0,0 +1,61 @@
+#ifndef ROSTERFORMATS_H
+#define ROSTERFORMATS_H
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include "Roster.h"
+#include "RosterImport.h"
+
+class TextBuffer;
+
+// CSV and line-delimited JSON (NDJSON) for analytics tools, next to the
+// TEAMNAME:/PLAYER: text format. Both carry one player per record with the
+// columns below, the team name repeated on each:
+//
+//   team,first_name,last_name,jersey,position,height_in,weight_lbs,age,ppg,rpg,apg
+//
+// Writers stream through one TextBuffer flushed every megabyte, so memory
+// does not grow with the roster. Readers parse a mapped file in place and
+// feed RosterImporter, which validates and deduplicates as for the text
+// format; only fields with escapes are copied, into reused scratch strings.
+
+enum class RosterFormat {
+    Text,     // TEAMNAME:/PLAYER: lines, as saveRoster writes
+    Csv,      // RFC 4180 quoting, header row first
+    Ndjson    // One JSON object per line
+};
+
+// .csv is Csv, .ndjson/.jsonl/.json is Ndjson, anything else Text
+RosterFormat formatForFilename(const std::string& filename);
+
+// Header row, ending in a newline
+void appendCsvHeader(TextBuffer& out);
+// One record each; `teamField` is the team name already quoted or escaped
+// for the format (see appendCsvField/appendJsonString)
+void appendPlayerCsv(TextBuffer& out, const Player& p, std::string_view teamField);
+void appendPlayerJson(TextBuffer& out, const Player& p, std::string_view teamField);
+
+// Field and string encoders: quotes only when needed / always, with escapes
+void appendCsvField(TextBuffer& out, std::string_view field);
+void appendJsonString(TextBuffer& out, std::string_view text);
+
+void writeRosterCsv(std::ostream& out, const Roster& roster);
+void writeRosterNdjson(std::ostream& out, const Roster& roster);
+
+// Writes the file atomically, as saveRoster does; Text is saveRoster itself
+bool exportRoster(const Roster& roster, const std::string& filename, RosterFormat format);
+
+// Import counterparts of importRosterText. Numbers must be plain decimals as
+// the writers produce them (no exponents); unknown columns or keys are ignored.
+// NDJSON names and position must be JSON strings, the numbers bare numbers.
+void importRosterCsv(Roster& roster, std::string_view text, ImportReport& report,
+                     const ImportOptions& options = ImportOptions());
+void importRosterNdjson(Roster& roster, std::string_view text, ImportReport& report,
+                        const ImportOptions& options = ImportOptions());
+
+// Maps the file and imports it in `format`; false if it cannot be opened
+bool importRosterFile(Roster& roster, const std::string& filename, RosterFormat format,
+                      ImportReport& report, const ImportOptions& options = ImportOptions());
+
+#endif // ROSTERFORMATS_H
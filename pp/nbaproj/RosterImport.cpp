@@ -0,0 +1,272 @@
+#include "RosterImport.h"
+#include "InputValidator.h"
+#include "MappedFile.h"
+#include "TextBuffer.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+const std::string_view TEAM_PREFIX = "TEAMNAME:";
+const std::string_view PLAYER_PREFIX = "PLAYER:";
+const std::string_view SEQUENCE_PREFIX = "JOURNALSEQ:";   // Written into journal snapshots
+const size_t QUOTED_FIELD_MAX = 40;
+
+// The offending field for an error message, cut short if it is long
+std::string quoted(std::string_view field) {
+    std::string text = "'";
+    text.append(field.data(), std::min(field.size(), QUOTED_FIELD_MAX));
+    if (field.size() > QUOTED_FIELD_MAX) {
+        text += "...";
+    }
+    return text + "'";
+}
+
+std::string intRangeError(const char* what, std::string_view field, int min, int max) {
+    return std::string(what) + " " + quoted(field) + " is not a whole number from " +
+           std::to_string(min) + " to " + std::to_string(max);
+}
+
+std::string nameError(const char* what, std::string_view field) {
+    return std::string(what) + " " + quoted(field) +
+           " must be letters, spaces, hyphens or apostrophes";
+}
+
+std::string doubleRangeError(const char* what, std::string_view field, double max) {
+    TextBuffer out;
+    out.append(what).append(' ').append(quoted(field)).append(" is not a number from 0.0 to ")
+       .appendFixed(max, 1);
+    return out.str();
+}
+
+} // namespace
+
+RosterImporter::RosterImporter(Roster& target, ImportReport& result, const ImportOptions& importOptions)
+    : roster(target), report(result), options(importOptions),
+      claimedBy(MAX_JERSEY - MIN_JERSEY + 1, 0), pendingAdds(0) {
+    if (options.batchSize == 0) {
+        options.batchSize = 1;
+    }
+    batch.reserve(std::min<size_t>(options.batchSize, MAX_JERSEY - MIN_JERSEY + 1));
+}
+
+void RosterImporter::addError(size_t line, const std::string& message) {
+    reject(line, [&] { return message; });
+}
+
+bool RosterImporter::validateFields(size_t line, const std::string_view* fields, Player& result) {
+    std::string_view trimmed;
+    if (!checkName(fields[0], trimmed)) {
+        reject(line, [&] { return nameError("first name", fields[0]); });
+        return false;
+    }
+    capitalizeInto(trimmed, firstName);
+    if (!checkName(fields[1], trimmed)) {
+        reject(line, [&] { return nameError("last name", fields[1]); });
+        return false;
+    }
+    capitalizeInto(trimmed, lastName);
+    if (!checkJerseyNumber(fields[2], result.jerseyNumber)) {
+        reject(line, [&] { return intRangeError("jersey number", fields[2], MIN_JERSEY, MAX_JERSEY); });
+        return false;
+    }
+    if (!checkPosition(fields[3], position)) {
+        reject(line, [&] { return "position " + quoted(fields[3]) + " is not one of PG, SG, SF, PF, C"; });
+        return false;
+    }
+    if (!checkPositiveInt(fields[4], result.heightInches, MIN_HEIGHT, MAX_HEIGHT)) {
+        reject(line, [&] { return intRangeError("height", fields[4], MIN_HEIGHT, MAX_HEIGHT); });
+        return false;
+    }
+    if (!checkPositiveInt(fields[5], result.weightLbs, MIN_WEIGHT, MAX_WEIGHT)) {
+        reject(line, [&] { return intRangeError("weight", fields[5], MIN_WEIGHT, MAX_WEIGHT); });
+        return false;
+    }
+    if (!checkPositiveInt(fields[6], result.age, MIN_AGE, MAX_AGE)) {
+        reject(line, [&] { return intRangeError("age", fields[6], MIN_AGE, MAX_AGE); });
+        return false;
+    }
+    if (!checkPositiveDouble(fields[7], result.pointsPerGame, 0.0, MAX_PPG)) {
+        reject(line, [&] { return doubleRangeError("PPG", fields[7], MAX_PPG); });
+        return false;
+    }
+    if (!checkPositiveDouble(fields[8], result.reboundsPerGame, 0.0, MAX_RPG)) {
+        reject(line, [&] { return doubleRangeError("RPG", fields[8], MAX_RPG); });
+        return false;
+    }
+    if (!checkPositiveDouble(fields[9], result.assistsPerGame, 0.0, MAX_APG)) {
+        reject(line, [&] { return doubleRangeError("APG", fields[9], MAX_APG); });
+        return false;
+    }
+    return true;
+}
+
+void RosterImporter::internNames(Player& result) const {
+    result.firstName = InternedString(std::string_view(firstName));
+    result.lastName = InternedString(std::string_view(lastName));
+    result.position = InternedString(position);
+}
+
+bool RosterImporter::checkRecord(size_t line, const std::string_view* fields, Player& result) {
+    if (!validateFields(line, fields, result)) {
+        return false;
+    }
+    internNames(result);
+    return true;
+}
+
+void RosterImporter::addFields(size_t line, const std::string_view* fields, size_t count) {
+    report.records++;
+    if (count != PLAYER_FIELD_COUNT) {
+        reject(line, [&] {
+            return "expected " + std::to_string(PLAYER_FIELD_COUNT) + " fields, found " + std::to_string(count);
+        });
+        return;
+    }
+
+    Player p;
+    if (!validateFields(line, fields, p)) {
+        return;
+    }
+
+    // Dedup: the first record for a jersey wins, later ones are reported against it
+    size_t& claim = claimedBy[p.jerseyNumber - MIN_JERSEY];
+    if (claim != 0) {
+        reject(line, [&] {
+            return "jersey " + std::to_string(p.jerseyNumber) + " is already used on line " + std::to_string(claim);
+        });
+        return;
+    }
+    bool editing = roster.isJerseyTaken(p.jerseyNumber);
+    if (editing) {
+        if (!options.updateExisting) {
+            reject(line, [&] { return "jersey " + std::to_string(p.jerseyNumber) + " is already on the roster"; });
+            return;
+        }
+    } else {
+        if (roster.getSize() + pendingAdds >= roster.getRosterSizeCap()) {
+            reject(line, [&] { return "roster is full (" + std::to_string(roster.getRosterSizeCap()) + " players)"; });
+            return;
+        }
+        pendingAdds++;
+    }
+
+    // Names are interned only once the record is accepted
+    internNames(p);
+    if (editing) {
+        batch.edit(p.jerseyNumber, p);
+    } else {
+        batch.add(p);
+    }
+    claim = line;
+    batchLines.push_back(line);
+
+    if (batch.size() >= options.batchSize) {
+        applyBatch();
+    }
+}
+
+void RosterImporter::addRecord(size_t line, std::string_view record) {
+    // Same field rules as parsePlayerRecord: a single trailing comma adds no field
+    if (!record.empty() && record.back() == ',') {
+        record.remove_suffix(1);
+    }
+
+    std::string_view fields[PLAYER_FIELD_COUNT];
+    size_t count = 0;
+    size_t start = 0;
+    while (true) {
+        size_t comma = record.find(',', start);
+        size_t end = comma == std::string_view::npos ? record.size() : comma;
+        if (count < PLAYER_FIELD_COUNT) {
+            fields[count] = record.substr(start, end - start);
+        }
+        count++;
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        start = comma + 1;
+    }
+    addFields(line, fields, count);
+}
+
+void RosterImporter::applyBatch() {
+    if (batch.empty()) {
+        return;
+    }
+
+    size_t failedOp = 0;
+    if (roster.apply(batch, &failedOp)) {
+        for (const auto& op : batch.getOps()) {
+            if (op.kind == RosterBatch::OpKind::Add) {
+                report.added++;
+            } else {
+                report.updated++;
+            }
+        }
+    } else {
+        // Every record was checked against the roster already, so this only
+        // happens if the roster was changed while the import was running
+        size_t line = batchLines[std::min(failedOp, batchLines.size() - 1)];
+        reject(line, [&] {
+            return "the roster rejected this record; " + std::to_string(batch.size()) +
+                   " record(s) from line " + std::to_string(batchLines.front()) + " were not applied";
+        });
+        report.rejected += batch.size() - 1;
+        // None of those jerseys were taken, so later records may claim them
+        for (const auto& op : batch.getOps()) {
+            int jersey = op.kind == RosterBatch::OpKind::Add ? op.player.jerseyNumber : op.jerseyNumber;
+            claimedBy[jersey - MIN_JERSEY] = 0;
+        }
+    }
+    batch.clear();
+    batchLines.clear();
+    pendingAdds = 0;
+}
+
+void RosterImporter::finish() {
+    applyBatch();
+}
+
+void importRosterText(Roster& roster, std::string_view text, ImportReport& report,
+                      const ImportOptions& options) {
+    RosterImporter importer(roster, report, options);
+    size_t lineNumber = 0;
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t newline = text.find('\n', start);
+        if (newline == std::string_view::npos) {
+            newline = text.size();
+        }
+        std::string_view line = text.substr(start, newline - start);
+        start = newline + 1;
+        lineNumber++;
+
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty()) continue;
+
+        if (line.substr(0, PLAYER_PREFIX.size()) == PLAYER_PREFIX) {
+            importer.addRecord(lineNumber, line.substr(PLAYER_PREFIX.size()));
+        } else if (line.substr(0, TEAM_PREFIX.size()) == TEAM_PREFIX) {
+            line.remove_prefix(TEAM_PREFIX.size());
+            report.teamName.assign(line.data(), line.size());
+            report.hasTeamName = true;
+        } else if (line.substr(0, SEQUENCE_PREFIX.size()) != SEQUENCE_PREFIX) {
+            importer.addError(lineNumber, "not a TEAMNAME: or PLAYER: line");
+        }
+    }
+    importer.finish();
+}
+
+bool importRoster(Roster& roster, const std::string& filename, ImportReport& report,
+                  const ImportOptions& options) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        std::cerr << "  Error: Could not open file for reading.\n";
+        return false;
+    }
+    importRosterText(roster, file.view(), report, options);
+    return true;
+}
@@ -0,0 +1,103 @@
+#ifndef ROSTERIMPORT_H
+#define ROSTERIMPORT_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Roster.h"
+
+// Bulk import of external player data with the same rules as the add-player
+// prompts. Unlike loadRoster, which trusts its file, every record is
+// validated field by field, jersey numbers are checked against the roster
+// and the rest of the import, and anything rejected is reported by line.
+//
+// Records flow through parse -> validate -> dedup and are applied to the
+// roster one RosterBatch at a time, so memory stays bounded by the batch
+// size and the error list however large the input is. New players count
+// against the roster's own size cap (Roster::getRosterSizeCap, 15 unless the
+// roster was built with another), and every add past it is rejected as
+// "roster is full"; import into a roster built with a larger cap to take more.
+
+struct ImportOptions {
+    size_t batchSize;        // Accepted records per roster update
+    size_t maxErrors;        // Errors kept in the report; later ones are only counted
+    bool updateExisting;     // A jersey already on the roster updates that player
+                             // instead of being rejected as a duplicate
+
+    ImportOptions() : batchSize(4096), maxErrors(1000), updateExisting(false) {}
+};
+
+struct ImportError {
+    size_t line;             // 1-based line in the input
+    std::string message;
+};
+
+struct ImportReport {
+    size_t records;          // Player records read
+    size_t added;
+    size_t updated;
+    size_t rejected;         // Lines that produced an error
+    std::vector<ImportError> errors;   // The first maxErrors, in line order
+    std::string teamName;    // Last TEAMNAME: line, or the first CSV/NDJSON record's
+                             // team; reported but not applied
+    bool hasTeamName;
+
+    ImportReport() : records(0), added(0), updated(0), rejected(0), hasTeamName(false) {}
+};
+
+// Number of fields in a player record, in writePlayerRecord order
+const size_t PLAYER_FIELD_COUNT = 10;
+
+// The validate -> dedup -> apply stages, fed one record at a time by a format
+// reader. Call finish() after the last record to apply the final batch.
+class RosterImporter {
+private:
+    Roster& roster;
+    ImportReport& report;
+    ImportOptions options;
+    RosterBatch batch;
+    std::vector<size_t> batchLines;
+    std::vector<size_t> claimedBy;   // Line that took each jersey in this import, 0 if none
+    int pendingAdds;
+    std::string firstName;           // Reused capitalization buffers
+    std::string lastName;
+    std::string_view position;       // Points into VALID_POSITIONS
+
+    // Checks every field into `result` and the name/position members above
+    bool validateFields(size_t line, const std::string_view* fields, Player& result);
+    void internNames(Player& result) const;
+    void applyBatch();
+
+    // Counts a rejected line; the message is only built while the report has room
+    template <typename Describe>
+    void reject(size_t line, Describe describe) {
+        report.rejected++;
+        if (report.errors.size() < options.maxErrors) {
+            report.errors.push_back(ImportError{line, describe()});
+        }
+    }
+
+public:
+    RosterImporter(Roster& target, ImportReport& result, const ImportOptions& importOptions = ImportOptions());
+
+    // Fields in writePlayerRecord order; `count` other than PLAYER_FIELD_COUNT is an error
+    void addFields(size_t line, const std::string_view* fields, size_t count);
+    // Comma-separated fields, the text after "PLAYER:"
+    void addRecord(size_t line, std::string_view record);
+    void addError(size_t line, const std::string& message);
+    void finish();
+
+    // Validation alone, with no dedup or apply: fills `result`, or reports
+    // the first bad field against `line` and returns false
+    bool checkRecord(size_t line, const std::string_view* fields, Player& result);
+};
+
+// Imports roster.txt-format text (TEAMNAME:/PLAYER: lines) into `roster`
+void importRosterText(Roster& roster, std::string_view text, ImportReport& report,
+                      const ImportOptions& options = ImportOptions());
+
+// Same, from a file; false if it cannot be opened
+bool importRoster(Roster& roster, const std::string& filename, ImportReport& report,
+                  const ImportOptions& options = ImportOptions());
+
+#endif // ROSTERIMPORT_H
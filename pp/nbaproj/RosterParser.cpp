@@ -0,0 +1,167 @@
+#include "RosterParser.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <iterator>
+#include <thread>
+
+namespace {
+
+const std::string_view TEAM_PREFIX = "TEAMNAME:";
+const std::string_view PLAYER_PREFIX = "PLAYER:";
+const size_t PLAYER_FIELDS = 10;
+const size_t MIN_CHUNK_BYTES = 1 << 20;   // Below this a thread costs more than it saves
+
+std::string_view skipLeadingSpace(std::string_view field) {
+    size_t i = 0;
+    while (i < field.size() && std::isspace(static_cast<unsigned char>(field[i]))) {
+        ++i;
+    }
+    field.remove_prefix(i);
+    // from_chars rejects an explicit '+', stoi/stod accept it
+    if (field.size() > 1 && field[0] == '+' && field[1] != '-') {
+        field.remove_prefix(1);
+    }
+    return field;
+}
+
+} // namespace
+
+bool parseIntField(std::string_view field, int& result) {
+    field = skipLeadingSpace(field);
+    auto parsed = std::from_chars(field.data(), field.data() + field.size(), result);
+    return parsed.ec == std::errc();
+}
+
+bool parseDoubleField(std::string_view field, double& result) {
+    field = skipLeadingSpace(field);
+    auto parsed = std::from_chars(field.data(), field.data() + field.size(), result);
+    return parsed.ec == std::errc();
+}
+
+bool parsePlayerRecord(std::string_view record, Player& result) {
+    // Same field rules as splitString: a single trailing delimiter adds no field
+    if (!record.empty() && record.back() == ',') {
+        record.remove_suffix(1);
+    }
+
+    std::string_view fields[PLAYER_FIELDS];
+    size_t count = 0;
+    size_t start = 0;
+    while (start <= record.size()) {
+        size_t comma = record.find(',', start);
+        if (comma == std::string_view::npos) {
+            comma = record.size();
+        }
+        if (count == PLAYER_FIELDS) {
+            return false;
+        }
+        fields[count++] = record.substr(start, comma - start);
+        start = comma + 1;
+    }
+    if (count != PLAYER_FIELDS || record.empty()) {
+        return false;
+    }
+
+    Player p;
+    if (!parseIntField(fields[2], p.jerseyNumber) ||
+        !parseIntField(fields[4], p.heightInches) ||
+        !parseIntField(fields[5], p.weightLbs) ||
+        !parseIntField(fields[6], p.age) ||
+        !parseDoubleField(fields[7], p.pointsPerGame) ||
+        !parseDoubleField(fields[8], p.reboundsPerGame) ||
+        !parseDoubleField(fields[9], p.assistsPerGame)) {
+        return false;
+    }
+    p.firstName = InternedString(fields[0]);
+    p.lastName = InternedString(fields[1]);
+    p.position = InternedString(fields[3]);
+    result = std::move(p);
+    return true;
+}
+
+void parseRosterText(std::string_view text, ParsedRoster& result) {
+    // One player per line at most, so size the vector once up front
+    result.players.reserve(result.players.size() + std::count(text.begin(), text.end(), '\n') + 1);
+
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t newline = text.find('\n', start);
+        if (newline == std::string_view::npos) {
+            newline = text.size();
+        }
+        std::string_view line = text.substr(start, newline - start);
+        start = newline + 1;
+
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty()) continue;
+
+        if (line.substr(0, TEAM_PREFIX.size()) == TEAM_PREFIX) {
+            line.remove_prefix(TEAM_PREFIX.size());
+            result.teamName.assign(line.data(), line.size());
+            result.hasTeamName = true;
+            continue;
+        }
+
+        if (line.substr(0, PLAYER_PREFIX.size()) == PLAYER_PREFIX) {
+            line.remove_prefix(PLAYER_PREFIX.size());
+            result.players.emplace_back();
+            if (!parsePlayerRecord(line, result.players.back())) {
+                result.players.pop_back();
+                result.skippedRecords++;
+            }
+        }
+    }
+}
+
+void parseRosterTextParallel(std::string_view text, ParsedRoster& result, unsigned threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t chunkCount = std::min<size_t>(threads, text.size() / MIN_CHUNK_BYTES);
+    if (chunkCount <= 1) {
+        parseRosterText(text, result);
+        return;
+    }
+
+    // Cut at the first newline after each even split point so no line is divided
+    std::vector<std::string_view> chunks;
+    size_t start = 0;
+    for (size_t i = 1; i <= chunkCount && start < text.size(); ++i) {
+        size_t end = text.size();
+        if (i < chunkCount) {
+            end = text.find('\n', std::max(start, text.size() * i / chunkCount));
+            end = (end == std::string_view::npos) ? text.size() : end + 1;
+        }
+        chunks.push_back(text.substr(start, end - start));
+        start = end;
+    }
+
+    std::vector<ParsedRoster> partials(chunks.size());
+    std::vector<std::thread> workers;
+    workers.reserve(chunks.size() - 1);
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        workers.emplace_back([&chunks, &partials, i]() { parseRosterText(chunks[i], partials[i]); });
+    }
+    parseRosterText(chunks[0], partials[0]);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Merge in file order so player order and the last-TEAMNAME rule hold
+    size_t total = result.players.size();
+    for (const auto& partial : partials) {
+        total += partial.players.size();
+    }
+    result.players.reserve(total);
+    for (auto& partial : partials) {
+        if (partial.hasTeamName) {
+            result.teamName = std::move(partial.teamName);
+            result.hasTeamName = true;
+        }
+        std::move(partial.players.begin(), partial.players.end(), std::back_inserter(result.players));
+        result.skippedRecords += partial.skippedRecords;
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef ROSTERPARSER_H
+#define ROSTERPARSER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Player.h"
+
+// Contents of a TEAMNAME:/PLAYER: roster file
+struct ParsedRoster {
+    std::string teamName;      // Last TEAMNAME: line wins; empty if there was none
+    bool hasTeamName;          // Whether any TEAMNAME: line was seen
+    std::vector<Player> players;
+    size_t skippedRecords;     // PLAYER: lines with a bad field count or value
+
+    ParsedRoster() : hasTeamName(false), skippedRecords(0) {}
+};
+
+// Number parsing with std::stoi/std::stod leniency (leading whitespace and
+// sign, trailing junk ignored) but no exceptions or allocations
+bool parseIntField(std::string_view field, int& result);
+bool parseDoubleField(std::string_view field, double& result);
+
+// Parses the text after "PLAYER:" into `result`
+bool parsePlayerRecord(std::string_view record, Player& result);
+
+// Parses a whole roster buffer, appending to `result`
+void parseRosterText(std::string_view text, ParsedRoster& result);
+
+// Same result as parseRosterText, but splits the buffer at line boundaries
+// and parses the pieces on `threads` threads (0 = one per hardware thread).
+// Small buffers are parsed on the calling thread.
+void parseRosterTextParallel(std::string_view text, ParsedRoster& result, unsigned threads = 0);
+
+#endif // ROSTERPARSER_H
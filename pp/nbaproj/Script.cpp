@@ -0,0 +1,501 @@
+#include "Script.h"
+#include "FileHandler.h"
+#include "InputValidator.h"
+#include "Journal.h"
+#include "RosterFormats.h"
+#include "RosterImport.h"
+#include "TextBuffer.h"
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace {
+
+const size_t FLUSH_BYTES = 64 * 1024;
+const size_t DEFAULT_TOP = 5;
+const size_t SHOWN_IMPORT_ERRORS = 20;
+
+// Names for `edit`, in writePlayerRecord order
+const std::string_view EDIT_FIELDS[PLAYER_FIELD_COUNT] = {
+    "first", "last", "jersey", "position", "height", "weight", "age", "ppg", "rpg", "apg"};
+
+struct StatName {
+    std::string_view name;
+    PlayerStat stat;
+};
+const StatName STAT_NAMES[] = {
+    {"ppg", PlayerStat::Points}, {"rpg", PlayerStat::Rebounds}, {"apg", PlayerStat::Assists},
+    {"height", PlayerStat::Height}, {"weight", PlayerStat::Weight}, {"age", PlayerStat::Age}};
+
+std::string lowerCase(std::string_view text) {
+    std::string result(text);
+    for (char& c : result) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return result;
+}
+
+// First word of `text` and the trimmed remainder
+std::string_view splitWord(std::string_view text, std::string_view& rest) {
+    size_t space = text.find_first_of(" \t");
+    if (space == std::string_view::npos) {
+        rest = std::string_view();
+        return text;
+    }
+    rest = trimView(text.substr(space + 1));
+    return text.substr(0, space);
+}
+
+const StatName* findStat(std::string_view name) {
+    const StatName* stat = std::find_if(std::begin(STAT_NAMES), std::end(STAT_NAMES),
+                                        [&](const StatName& s) { return s.name == name; });
+    return stat == std::end(STAT_NAMES) ? nullptr : stat;
+}
+
+struct CompareName {
+    std::string_view op;
+    Compare compare;
+};
+// Two-character operators first, so "<=" is not read as "<"
+const CompareName COMPARE_NAMES[] = {
+    {"<=", Compare::LessEqual}, {">=", Compare::GreaterEqual}, {"<", Compare::Less},
+    {">", Compare::Greater}, {"=", Compare::Equal}};
+
+std::string shortest(double value) {
+    TextBuffer text;
+    text.appendShortest(value);
+    return text.str();
+}
+
+class ScriptRunner {
+private:
+    Roster& roster;
+    std::ostream& out;
+    std::ostream& err;
+    TextBuffer output;
+    TextBuffer teamField;   // Team name as a CSV field, for query rows
+
+    bool fail(size_t line, const std::string& message);
+    bool failReport(size_t line, const ImportReport& report);
+    bool parseJersey(size_t line, std::string_view text, int& jersey);
+    void beginRows();
+    void appendRow(const Player& p);
+
+    bool add(size_t line, std::string_view args);
+    bool remove(size_t line, std::string_view args);
+    bool edit(size_t line, std::string_view args);
+    bool team(size_t line, std::string_view args);
+    bool find(size_t line, std::string_view args);
+    bool top(size_t line, std::string_view args);
+    bool list(size_t line, std::string_view args);
+    bool select(size_t line, std::string_view args);
+    bool addClause(size_t line, std::string_view clause, PlayerQuery& query);
+    bool import(size_t line, std::string_view args);
+    bool save(size_t line, std::string_view args);
+    bool load(size_t line, std::string_view args);
+
+public:
+    ScriptRunner(Roster& target, std::ostream& output, std::ostream& errors);
+
+    bool run(size_t line, std::string_view command);
+    void flush();
+};
+
+ScriptRunner::ScriptRunner(Roster& target, std::ostream& output, std::ostream& errors)
+    : roster(target), out(output), err(errors) {}
+
+void ScriptRunner::flush() {
+    output.flush(out);
+    out.flush();
+}
+
+bool ScriptRunner::fail(size_t line, const std::string& message) {
+    // Query output so far goes first, so the two streams interleave in order
+    flush();
+    err << "  Error: line " << line << ": " << message << "\n";
+    return false;
+}
+
+bool ScriptRunner::failReport(size_t line, const ImportReport& report) {
+    flush();
+    for (const auto& error : report.errors) {
+        err << "  Error: line " << line << ": " << error.message << "\n";
+    }
+    return false;
+}
+
+bool ScriptRunner::parseJersey(size_t line, std::string_view text, int& jersey) {
+    if (checkJerseyNumber(text, jersey)) {
+        return true;
+    }
+    return fail(line, "jersey number '" + std::string(text) + "' is not a whole number from " +
+                      std::to_string(MIN_JERSEY) + " to " + std::to_string(MAX_JERSEY));
+}
+
+void ScriptRunner::beginRows() {
+    teamField.clear();
+    appendCsvField(teamField, roster.getTeamName());
+}
+
+void ScriptRunner::appendRow(const Player& p) {
+    appendPlayerCsv(output, p, teamField.str());
+    if (output.size() >= FLUSH_BYTES) {
+        output.flush(out);
+    }
+}
+
+bool ScriptRunner::run(size_t line, std::string_view command) {
+    std::string_view args;
+    std::string name = lowerCase(splitWord(command, args));
+
+    if (name == "add")    return add(line, args);
+    if (name == "remove") return remove(line, args);
+    if (name == "edit")   return edit(line, args);
+    if (name == "team")   return team(line, args);
+    if (name == "find")   return find(line, args);
+    if (name == "top")    return top(line, args);
+    if (name == "list")   return list(line, args);
+    if (name == "select") return select(line, args);
+    if (name == "import") return import(line, args);
+    if (name == "save")   return save(line, args);
+    if (name == "load")   return load(line, args);
+    return fail(line, "unknown command '" + name + "'");
+}
+
+bool ScriptRunner::add(size_t line, std::string_view args) {
+    // Same validation, dedup and messages as an imported record
+    ImportOptions options;
+    options.batchSize = 1;
+    ImportReport report;
+    RosterImporter importer(roster, report, options);
+    importer.addRecord(line, args);
+    importer.finish();
+    return report.rejected == 0 || failReport(line, report);
+}
+
+bool ScriptRunner::remove(size_t line, std::string_view args) {
+    int jersey;
+    if (!parseJersey(line, args, jersey)) {
+        return false;
+    }
+    if (!roster.removePlayer(jersey)) {
+        return fail(line, "no player wears #" + std::to_string(jersey));
+    }
+    return true;
+}
+
+bool ScriptRunner::edit(size_t line, std::string_view args) {
+    std::string_view assignments;
+    int jersey;
+    if (!parseJersey(line, splitWord(args, assignments), jersey)) {
+        return false;
+    }
+    const Player* current = roster.findByJersey(jersey);
+    if (current == nullptr) {
+        return fail(line, "no player wears #" + std::to_string(jersey));
+    }
+    if (assignments.empty()) {
+        return fail(line, "edit needs FIELD=VALUE");
+    }
+
+    // Start from the player's current fields and overwrite the named ones
+    std::string values[PLAYER_FIELD_COUNT] = {
+        current->firstName.str(), current->lastName.str(), std::to_string(current->jerseyNumber),
+        current->position.str(), std::to_string(current->heightInches),
+        std::to_string(current->weightLbs), std::to_string(current->age),
+        shortest(current->pointsPerGame), shortest(current->reboundsPerGame),
+        shortest(current->assistsPerGame)};
+    bool assigned[PLAYER_FIELD_COUNT] = {};
+    size_t start = 0;
+    while (start <= assignments.size()) {
+        size_t comma = std::min(assignments.find(',', start), assignments.size());
+        std::string_view assignment = trimView(assignments.substr(start, comma - start));
+        start = comma + 1;
+
+        size_t equals = assignment.find('=');
+        if (equals == std::string_view::npos) {
+            return fail(line, "expected FIELD=VALUE, found '" + std::string(assignment) + "'");
+        }
+        std::string field = lowerCase(trimView(assignment.substr(0, equals)));
+        const std::string_view* known = std::find(EDIT_FIELDS, EDIT_FIELDS + PLAYER_FIELD_COUNT, field);
+        if (known == EDIT_FIELDS + PLAYER_FIELD_COUNT) {
+            return fail(line, "unknown field '" + field + "'");
+        }
+        values[known - EDIT_FIELDS] = std::string(trimView(assignment.substr(equals + 1)));
+        assigned[known - EDIT_FIELDS] = true;
+    }
+
+    std::string_view fields[PLAYER_FIELD_COUNT];
+    std::copy(values, values + PLAYER_FIELD_COUNT, fields);
+    ImportReport report;
+    RosterImporter importer(roster, report);
+    Player updated;
+    if (!importer.checkRecord(line, fields, updated)) {
+        return failReport(line, report);
+    }
+    // Validation recapitalizes names; ones left alone keep their spelling (LeBron)
+    if (!assigned[0]) {
+        updated.firstName = current->firstName;
+    }
+    if (!assigned[1]) {
+        updated.lastName = current->lastName;
+    }
+    if (updated.jerseyNumber != jersey && roster.isJerseyTaken(updated.jerseyNumber)) {
+        return fail(line, "jersey " + std::to_string(updated.jerseyNumber) + " is already on the roster");
+    }
+    if (!roster.editPlayer(jersey, updated)) {
+        return fail(line, "could not edit #" + std::to_string(jersey));
+    }
+    return true;
+}
+
+bool ScriptRunner::team(size_t line, std::string_view args) {
+    std::string_view name;
+    if (!checkTeamName(args, name)) {
+        return fail(line, "team needs a name without control characters");
+    }
+    roster.setTeamName(std::string(name));
+    return true;
+}
+
+bool ScriptRunner::find(size_t line, std::string_view args) {
+    std::string_view query;
+    std::string kind = lowerCase(splitWord(args, query));
+    beginRows();
+
+    if (kind == "name") {
+        for (const auto& p : roster.viewByName(std::string(query))) {
+            appendRow(p);
+        }
+        return true;
+    }
+    if (kind == "jersey") {
+        int jersey;
+        if (!parseJersey(line, query, jersey)) {
+            return false;
+        }
+        const Player* p = roster.findByJersey(jersey);
+        if (p != nullptr) {
+            appendRow(*p);
+        }
+        return true;
+    }
+    if (kind == "position") {
+        std::string_view position;
+        if (!checkPosition(query, position)) {
+            return fail(line, "position '" + std::string(query) + "' is not one of PG, SG, SF, PF, C");
+        }
+        for (const auto& p : roster.viewByPosition(std::string(position))) {
+            appendRow(p);
+        }
+        return true;
+    }
+    return fail(line, "find takes name, jersey or position");
+}
+
+bool ScriptRunner::top(size_t line, std::string_view args) {
+    std::string_view countText;
+    std::string statName = lowerCase(splitWord(args, countText));
+    const StatName* stat = findStat(statName);
+    if (stat == nullptr) {
+        return fail(line, "top takes ppg, rpg, apg, height, weight or age");
+    }
+    int count = static_cast<int>(DEFAULT_TOP);
+    if (!countText.empty() &&
+        !checkPositiveInt(countText, count, 1, std::numeric_limits<int>::max())) {
+        return fail(line, "count '" + std::string(countText) + "' is not a positive whole number");
+    }
+
+    beginRows();
+    for (const Player* p : roster.topPlayers(stat->stat, static_cast<size_t>(count))) {
+        appendRow(*p);
+    }
+    return true;
+}
+
+bool ScriptRunner::list(size_t line, std::string_view args) {
+    if (!args.empty()) {
+        return fail(line, "list takes no arguments");
+    }
+    beginRows();
+    for (const auto& p : roster.getPlayers()) {
+        appendRow(p);
+    }
+    return true;
+}
+
+bool ScriptRunner::select(size_t line, std::string_view args) {
+    PlayerQuery query;
+    size_t start = 0;
+    while (!args.empty() && start <= args.size()) {
+        size_t comma = std::min(args.find(',', start), args.size());
+        if (!addClause(line, trimView(args.substr(start, comma - start)), query)) {
+            return false;
+        }
+        start = comma + 1;
+    }
+
+    beginRows();
+    const std::vector<Player>& players = roster.getPlayers();
+    for (int index : roster.select(query)) {
+        appendRow(players[index]);
+    }
+    return true;
+}
+
+bool ScriptRunner::addClause(size_t line, std::string_view clause, PlayerQuery& query) {
+    size_t opStart = clause.find_first_of("<>=");
+    if (opStart == std::string_view::npos || opStart == 0) {
+        return fail(line, "expected FIELD=VALUE or STAT<op>VALUE, found '" + std::string(clause) + "'");
+    }
+    const CompareName* op = std::find_if(std::begin(COMPARE_NAMES), std::end(COMPARE_NAMES),
+        [&](const CompareName& c) { return clause.substr(opStart, c.op.size()) == c.op; });
+    std::string field = lowerCase(trimView(clause.substr(0, opStart)));
+    std::string_view value = trimView(clause.substr(opStart + op->op.size()));
+
+    const StatName* stat = findStat(field);
+    if (stat != nullptr) {
+        double target;
+        if (!checkPositiveDouble(value, target, 0.0, std::numeric_limits<double>::max())) {
+            return fail(line, field + " value '" + std::string(value) + "' is not a number");
+        }
+        query.where(stat->stat, op->compare, target);
+        return true;
+    }
+    if (op->compare != Compare::Equal) {
+        return fail(line, "'" + field + "' takes =, not " + std::string(op->op));
+    }
+    if (field == "name") {
+        query.nameContains(std::string(value));
+        return true;
+    }
+    if (field == "jersey") {
+        int jersey;
+        if (!parseJersey(line, value, jersey)) {
+            return false;
+        }
+        query.jerseyIs(jersey);
+        return true;
+    }
+    if (field == "position") {
+        std::vector<std::string> positions;
+        while (!value.empty()) {
+            std::string_view position;
+            if (!checkPosition(splitWord(value, value), position)) {
+                return fail(line, "position list '" + std::string(clause.substr(opStart + 1)) +
+                                  "' has a position other than PG, SG, SF, PF, C");
+            }
+            positions.emplace_back(position);
+        }
+        query.positionIn(positions);
+        return true;
+    }
+    if (field == "order") {
+        std::string_view direction;
+        std::string orderName = lowerCase(splitWord(value, direction));
+        const StatName* orderStat = findStat(orderName);
+        std::string dir = lowerCase(direction);
+        if (orderStat == nullptr || (dir != "" && dir != "asc" && dir != "desc")) {
+            return fail(line, "order takes ppg, rpg, apg, height, weight or age, then asc or desc");
+        }
+        query.orderBy(orderStat->stat, dir != "asc");
+        return true;
+    }
+    if (field == "limit") {
+        int count;
+        if (!checkPositiveInt(value, count, 0, std::numeric_limits<int>::max())) {
+            return fail(line, "limit '" + std::string(value) + "' is not a whole number");
+        }
+        query.limit(static_cast<size_t>(count));
+        return true;
+    }
+    return fail(line, "unknown field '" + field + "'");
+}
+
+bool ScriptRunner::import(size_t line, std::string_view args) {
+    ImportOptions options;
+    std::string_view last = args.substr(std::min(args.find_last_of(" \t") + 1, args.size()));
+    if (args.size() > last.size() && lowerCase(last) == "update") {
+        options.updateExisting = true;
+        args = trimView(args.substr(0, args.size() - last.size()));
+    }
+    std::string filename(args);
+    if (filename.empty() || !fileExists(filename)) {
+        return fail(line, "file '" + filename + "' not found");
+    }
+
+    ImportReport report;
+    if (!importRosterFile(roster, filename, formatForFilename(filename), report, options)) {
+        return fail(line, "could not read '" + filename + "'");
+    }
+    if (report.rejected == 0) {
+        return true;
+    }
+
+    flush();
+    size_t shown = std::min(report.errors.size(), SHOWN_IMPORT_ERRORS);
+    for (size_t i = 0; i < shown; ++i) {
+        err << "  Error: line " << line << ": " << filename << " line " << report.errors[i].line
+            << ": " << report.errors[i].message << "\n";
+    }
+    if (report.rejected > shown) {
+        err << "  Error: line " << line << ": " << (report.rejected - shown) << " more rejected\n";
+    }
+    return false;
+}
+
+bool ScriptRunner::save(size_t line, std::string_view args) {
+    RosterJournal* journal = roster.getJournal();
+    std::string snapshot = journal != nullptr ? journal->getSnapshotFile() : DATA_FILE;
+    std::string filename = args.empty() ? snapshot : std::string(args);
+    if (!isSameFile(filename, snapshot)) {
+        RosterFormat format = formatForFilename(filename);
+        bool written = format == RosterFormat::Text ? saveRoster(roster, filename)
+                                                    : exportRoster(roster, filename, format);
+        return written || fail(line, "could not write '" + filename + "'");
+    }
+
+    // Same as the Save Roster menu option; the roster file is only written
+    // through the journal, so recovery never replays edits it already holds
+    bool saved = journal != nullptr ? journal->commit(roster) : saveRoster(roster, snapshot);
+    if (!saved) {
+        return fail(line, "could not save '" + filename + "'");
+    }
+    roster.markSaved();
+    return true;
+}
+
+bool ScriptRunner::load(size_t line, std::string_view args) {
+    if (!args.empty()) {
+        return fail(line, "load takes no arguments; use import FILE");
+    }
+    if (!fileExists(DATA_FILE)) {
+        return fail(line, "file '" + DATA_FILE + "' not found");
+    }
+    RosterJournal* journal = roster.getJournal();
+    bool loaded = journal != nullptr ? journal->recover(roster) >= 0 : loadRoster(roster, DATA_FILE);
+    return loaded || fail(line, "could not load '" + DATA_FILE + "'");
+}
+
+} // namespace
+
+ScriptSummary runScript(Roster& roster, std::istream& in, std::ostream& out, std::ostream& err) {
+    ScriptRunner runner(roster, out, err);
+    ScriptSummary summary;
+    std::string text;
+    size_t line = 0;
+    while (std::getline(in, text)) {
+        line++;
+        std::string_view command = trimView(text);
+        if (command.empty() || command[0] == '#') continue;
+
+        summary.commands++;
+        if (!runner.run(line, command)) {
+            summary.failed++;
+        }
+    }
+    runner.flush();
+    return summary;
+}
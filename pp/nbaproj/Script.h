@@ -0,0 +1,41 @@
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#include <istream>
+#include <ostream>
+#include "Roster.h"
+
+// Non-interactive roster commands for batch jobs: `roster_manager --script
+// FILE` (or `-` for stdin). One command per line, run back to back with no
+// prompts, screen clearing or pauses. Blank lines and lines starting with #
+// are skipped.
+//
+//   add FIRST,LAST,JERSEY,POS,HEIGHT,WEIGHT,AGE,PPG,RPG,APG
+//   remove JERSEY
+//   edit JERSEY FIELD=VALUE[, FIELD=VALUE ...]
+//        fields: first last jersey position height weight age ppg rpg apg
+//   team NAME                   any text on the line, kept as typed
+//   find name TEXT | find jersey N | find position POS
+//   top ppg|rpg|apg|height|weight|age [N]
+//   list
+//   select [CLAUSE[, CLAUSE ...]]   every clause must match; see PlayerQuery
+//        STAT<op>VALUE  with STAT as for top and op one of < <= = >= >
+//        position=POS [POS ...]   jersey=N   name=TEXT
+//        order=STAT [asc|desc]   limit=N
+//   import FILE [update]        .txt, .csv or .ndjson, validated as [11]
+//   save [FILE]                 no FILE or the roster file: as [8]; else by extension
+//   load                        the roster file, as [9]
+//
+// Queries print CSV records (see RosterFormats.h) to `out`; failures go to
+// `err` with their line number and the script carries on.
+
+struct ScriptSummary {
+    size_t commands;
+    size_t failed;
+
+    ScriptSummary() : commands(0), failed(0) {}
+};
+
+ScriptSummary runScript(Roster& roster, std::istream& in, std::ostream& out, std::ostream& err);
+
+#endif // SCRIPT_H
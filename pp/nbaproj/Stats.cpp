@@ -0,0 +1,347 @@
+#include "Stats.h"
+#include "Roster.h"
+#include "League.h"
+#include "PlayerTable.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define STATS_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Every kernel accumulates element i into lane i % LANES and reduces the
+// lanes as (0 + 1) + (2 + 3). Keeping that order fixed is what makes the
+// SIMD paths agree bit for bit with the scalar one.
+const size_t LANES = 4;
+
+double reduceLanes(const double lanes[LANES]) {
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+// min and max skip NaN: the accumulator starts at +/-infinity and std::min /
+// std::max keep their first argument when the comparison with NaN is false.
+// The SIMD kernels pass the new value first for the same reason: MINPD and
+// MAXPD return their second operand when either one is NaN.
+template <typename T>
+void sumMinMaxScalar(const T* values, size_t count, double lanes[LANES], double& min, double& max) {
+    for (size_t i = 0; i < count; ++i) {
+        double x = values[i];
+        lanes[i % LANES] += x;
+        min = std::min(min, x);
+        max = std::max(max, x);
+    }
+}
+
+template <typename T>
+void squaredDeviationsScalar(const T* values, size_t count, double mean, double lanes[LANES]) {
+    for (size_t i = 0; i < count; ++i) {
+        double d = values[i] - mean;
+        lanes[i % LANES] += d * d;
+    }
+}
+
+#ifdef STATS_X86_KERNELS
+
+// SSE2: lanes 0-1 and 2-3 live in two 128-bit registers
+
+__attribute__((target("sse2")))
+inline void load4(const double* p, __m128d& lo, __m128d& hi) {
+    lo = _mm_loadu_pd(p);
+    hi = _mm_loadu_pd(p + 2);
+}
+
+__attribute__((target("sse2")))
+inline void load4(const int* p, __m128d& lo, __m128d& hi) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    lo = _mm_cvtepi32_pd(x);
+    hi = _mm_cvtepi32_pd(_mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+template <typename T>
+__attribute__((target("sse2")))
+void sumMinMaxSse2(const T* values, size_t count, double lanes[LANES], double& min, double& max) {
+    size_t body = count - count % LANES;
+    __m128d sumLo = _mm_setzero_pd();
+    __m128d sumHi = _mm_setzero_pd();
+    __m128d vmin = _mm_set1_pd(min);
+    __m128d vmax = _mm_set1_pd(max);
+    for (size_t i = 0; i < body; i += LANES) {
+        __m128d lo, hi;
+        load4(values + i, lo, hi);
+        sumLo = _mm_add_pd(sumLo, lo);
+        sumHi = _mm_add_pd(sumHi, hi);
+        vmin = _mm_min_pd(hi, _mm_min_pd(lo, vmin));
+        vmax = _mm_max_pd(hi, _mm_max_pd(lo, vmax));
+    }
+    _mm_storeu_pd(lanes, _mm_add_pd(_mm_loadu_pd(lanes), sumLo));
+    _mm_storeu_pd(lanes + 2, _mm_add_pd(_mm_loadu_pd(lanes + 2), sumHi));
+
+    double extremes[2];
+    _mm_storeu_pd(extremes, vmin);
+    min = std::min(extremes[0], extremes[1]);
+    _mm_storeu_pd(extremes, vmax);
+    max = std::max(extremes[0], extremes[1]);
+
+    sumMinMaxScalar(values + body, count - body, lanes, min, max);
+}
+
+template <typename T>
+__attribute__((target("sse2")))
+void squaredDeviationsSse2(const T* values, size_t count, double mean, double lanes[LANES]) {
+    size_t body = count - count % LANES;
+    __m128d vmean = _mm_set1_pd(mean);
+    __m128d sumLo = _mm_setzero_pd();
+    __m128d sumHi = _mm_setzero_pd();
+    for (size_t i = 0; i < body; i += LANES) {
+        __m128d lo, hi;
+        load4(values + i, lo, hi);
+        lo = _mm_sub_pd(lo, vmean);
+        hi = _mm_sub_pd(hi, vmean);
+        sumLo = _mm_add_pd(sumLo, _mm_mul_pd(lo, lo));
+        sumHi = _mm_add_pd(sumHi, _mm_mul_pd(hi, hi));
+    }
+    _mm_storeu_pd(lanes, _mm_add_pd(_mm_loadu_pd(lanes), sumLo));
+    _mm_storeu_pd(lanes + 2, _mm_add_pd(_mm_loadu_pd(lanes + 2), sumHi));
+
+    squaredDeviationsScalar(values + body, count - body, mean, lanes);
+}
+
+// AVX2: all four lanes in one 256-bit register. FMA is deliberately not
+// enabled so the multiply-add rounds exactly like the other paths.
+
+__attribute__((target("avx2")))
+inline __m256d load4(const double* p) {
+    return _mm256_loadu_pd(p);
+}
+
+__attribute__((target("avx2")))
+inline __m256d load4(const int* p) {
+    return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+}
+
+template <typename T>
+__attribute__((target("avx2")))
+void sumMinMaxAvx2(const T* values, size_t count, double lanes[LANES], double& min, double& max) {
+    size_t body = count - count % LANES;
+    __m256d sum = _mm256_setzero_pd();
+    __m256d vmin = _mm256_set1_pd(min);
+    __m256d vmax = _mm256_set1_pd(max);
+    for (size_t i = 0; i < body; i += LANES) {
+        __m256d x = load4(values + i);
+        sum = _mm256_add_pd(sum, x);
+        vmin = _mm256_min_pd(x, vmin);
+        vmax = _mm256_max_pd(x, vmax);
+    }
+    _mm256_storeu_pd(lanes, _mm256_add_pd(_mm256_loadu_pd(lanes), sum));
+
+    double extremes[LANES];
+    _mm256_storeu_pd(extremes, vmin);
+    min = std::min(std::min(extremes[0], extremes[1]), std::min(extremes[2], extremes[3]));
+    _mm256_storeu_pd(extremes, vmax);
+    max = std::max(std::max(extremes[0], extremes[1]), std::max(extremes[2], extremes[3]));
+
+    sumMinMaxScalar(values + body, count - body, lanes, min, max);
+}
+
+template <typename T>
+__attribute__((target("avx2")))
+void squaredDeviationsAvx2(const T* values, size_t count, double mean, double lanes[LANES]) {
+    size_t body = count - count % LANES;
+    __m256d vmean = _mm256_set1_pd(mean);
+    __m256d sum = _mm256_setzero_pd();
+    for (size_t i = 0; i < body; i += LANES) {
+        __m256d d = _mm256_sub_pd(load4(values + i), vmean);
+        sum = _mm256_add_pd(sum, _mm256_mul_pd(d, d));
+    }
+    _mm256_storeu_pd(lanes, _mm256_add_pd(_mm256_loadu_pd(lanes), sum));
+
+    squaredDeviationsScalar(values + body, count - body, mean, lanes);
+}
+
+#endif // STATS_X86_KERNELS
+
+SimdLevel activeLevel = getSupportedSimdLevel();
+
+template <typename T>
+StatSummary summarizeColumn(const T* values, size_t count) {
+    StatSummary result;
+    if (count == 0) {
+        return result;
+    }
+
+    double sums[LANES] = {0.0, 0.0, 0.0, 0.0};
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    switch (activeLevel) {
+#ifdef STATS_X86_KERNELS
+        case SimdLevel::AVX2: sumMinMaxAvx2(values, count, sums, min, max); break;
+        case SimdLevel::SSE2: sumMinMaxSse2(values, count, sums, min, max); break;
+#endif
+        default:              sumMinMaxScalar(values, count, sums, min, max); break;
+    }
+
+    result.count = count;
+    result.sum = reduceLanes(sums);
+    result.mean = result.sum / count;
+    if (min > max) {
+        // Every value was NaN
+        min = max = std::numeric_limits<double>::quiet_NaN();
+    }
+    result.min = min;
+    result.max = max;
+
+    // Second pass over deviations; steadier than the sum-of-squares shortcut
+    double squares[LANES] = {0.0, 0.0, 0.0, 0.0};
+    switch (activeLevel) {
+#ifdef STATS_X86_KERNELS
+        case SimdLevel::AVX2: squaredDeviationsAvx2(values, count, result.mean, squares); break;
+        case SimdLevel::SSE2: squaredDeviationsSse2(values, count, result.mean, squares); break;
+#endif
+        default:              squaredDeviationsScalar(values, count, result.mean, squares); break;
+    }
+    result.variance = reduceLanes(squares) / count;
+    return result;
+}
+
+// Linear interpolation between the two closest ranks
+double percentileInPlace(std::vector<double>& values, double pct) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    pct = std::min(std::max(pct, 0.0), 100.0);
+    double rank = pct / 100.0 * (values.size() - 1);
+    size_t lower = static_cast<size_t>(std::floor(rank));
+    std::nth_element(values.begin(), values.begin() + lower, values.end());
+    double lowerValue = values[lower];
+    if (lower + 1 >= values.size()) {
+        return lowerValue;
+    }
+    double upperValue = *std::min_element(values.begin() + lower + 1, values.end());
+    return lowerValue + (upperValue - lowerValue) * (rank - lower);
+}
+
+bool isIntStat(PlayerStat stat) {
+    return stat == PlayerStat::Height || stat == PlayerStat::Weight || stat == PlayerStat::Age;
+}
+
+const std::vector<int>& intColumn(const PlayerTable& table, PlayerStat stat) {
+    switch (stat) {
+        case PlayerStat::Height: return table.getHeights();
+        case PlayerStat::Weight: return table.getWeights();
+        default:                 return table.getAges();
+    }
+}
+
+const std::vector<double>& doubleColumn(const PlayerTable& table, PlayerStat stat) {
+    switch (stat) {
+        case PlayerStat::Rebounds: return table.getRebounds();
+        case PlayerStat::Assists:  return table.getAssists();
+        default:                   return table.getPoints();
+    }
+}
+
+std::vector<double> gather(const Roster& roster, PlayerStat stat) {
+    const std::vector<Player>& players = roster.getPlayers();
+    std::vector<double> column;
+    column.reserve(players.size());
+    for (const auto& player : players) {
+        column.push_back(statValue(player, stat));
+    }
+    return column;
+}
+
+std::vector<double> gather(const League& league, PlayerStat stat) {
+    std::vector<double> column;
+    column.reserve(league.getRecordCount());
+    for (size_t i = 0; i < league.getRecordCount(); ++i) {
+        column.push_back(league.getStat(static_cast<uint32_t>(i), stat));
+    }
+    return column;
+}
+
+} // namespace
+
+SimdLevel getSimdLevel() {
+    return activeLevel;
+}
+
+SimdLevel getSupportedSimdLevel() {
+#ifdef STATS_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::SSE2;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+
+void setSimdLevel(SimdLevel level) {
+    activeLevel = std::min(level, getSupportedSimdLevel());
+}
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SSE2: return "SSE2";
+        default:              return "scalar";
+    }
+}
+
+StatSummary summarize(const double* values, size_t count) {
+    return summarizeColumn(values, count);
+}
+
+StatSummary summarize(const int* values, size_t count) {
+    return summarizeColumn(values, count);
+}
+
+double percentile(const double* values, size_t count, double pct) {
+    std::vector<double> copy(values, values + count);
+    return percentileInPlace(copy, pct);
+}
+
+double percentile(const int* values, size_t count, double pct) {
+    std::vector<double> copy(values, values + count);
+    return percentileInPlace(copy, pct);
+}
+
+StatSummary summarizeStat(const PlayerTable& table, PlayerStat stat) {
+    if (isIntStat(stat)) {
+        return summarize(intColumn(table, stat).data(), table.size());
+    }
+    return summarize(doubleColumn(table, stat).data(), table.size());
+}
+
+StatSummary summarizeStat(const Roster& roster, PlayerStat stat) {
+    std::vector<double> column = gather(roster, stat);
+    return summarize(column.data(), column.size());
+}
+
+StatSummary summarizeStat(const League& league, PlayerStat stat) {
+    std::vector<double> column = gather(league, stat);
+    return summarize(column.data(), column.size());
+}
+
+double statPercentile(const PlayerTable& table, PlayerStat stat, double pct) {
+    if (isIntStat(stat)) {
+        return percentile(intColumn(table, stat).data(), table.size(), pct);
+    }
+    return percentile(doubleColumn(table, stat).data(), table.size(), pct);
+}
+
+double statPercentile(const Roster& roster, PlayerStat stat, double pct) {
+    std::vector<double> column = gather(roster, stat);
+    return percentileInPlace(column, pct);
+}
+
+double statPercentile(const League& league, PlayerStat stat, double pct) {
+    std::vector<double> column = gather(league, stat);
+    return percentileInPlace(column, pct);
+}
@@ -0,0 +1,54 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <cstddef>
+#include <vector>
+#include "Player.h"
+
+class Roster;
+class League;
+class PlayerTable;
+
+// Aggregate over one numeric column. Variance is the population variance.
+// min and max skip NaN values (and are NaN only if every value is); sum,
+// mean and variance propagate it.
+struct StatSummary {
+    size_t count;
+    double sum;
+    double mean;
+    double min;
+    double max;
+    double variance;
+
+    StatSummary() : count(0), sum(0.0), mean(0.0), min(0.0), max(0.0), variance(0.0) {}
+};
+
+// Instruction sets the aggregation kernels can run on. The best one the CPU
+// supports is picked at startup; every level accumulates in the same four
+// lanes and reduces them in the same order, so results are bit-identical.
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2
+};
+
+SimdLevel getSimdLevel();
+SimdLevel getSupportedSimdLevel();
+void setSimdLevel(SimdLevel level);   // Clamped to what the CPU supports
+const char* simdLevelName(SimdLevel level);
+
+// Column kernels
+StatSummary summarize(const double* values, size_t count);
+StatSummary summarize(const int* values, size_t count);
+double percentile(const double* values, size_t count, double pct);   // pct in [0, 100]
+double percentile(const int* values, size_t count, double pct);
+
+// Per-stat aggregates
+StatSummary summarizeStat(const PlayerTable& table, PlayerStat stat);
+StatSummary summarizeStat(const Roster& roster, PlayerStat stat);
+StatSummary summarizeStat(const League& league, PlayerStat stat);
+double statPercentile(const PlayerTable& table, PlayerStat stat, double pct);
+double statPercentile(const Roster& roster, PlayerStat stat, double pct);
+double statPercentile(const League& league, PlayerStat stat, double pct);
+
+#endif // STATS_H
@@ -0,0 +1,29 @@
+#include "StringPool.h"
+
+uint32_t StringPool::intern(std::string_view str) {
+    auto it = ids.find(str);
+    if (it != ids.end()) {
+        return it->second;
+    }
+    uint32_t id = static_cast<uint32_t>(strings.size());
+    strings.emplace_back(str);
+    ids.emplace(strings.back(), id);
+    return id;
+}
+
+bool StringPool::find(std::string_view str, uint32_t& id) const {
+    auto it = ids.find(str);
+    if (it == ids.end()) {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
+
+const std::string& StringPool::get(uint32_t id) const {
+    return strings[id];
+}
+
+size_t StringPool::size() const {
+    return strings.size();
+}
@@ -0,0 +1,24 @@
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Stores each distinct string once and hands out stable 32-bit ids.
+// Ids stay valid for the lifetime of the pool.
+class StringPool {
+private:
+    std::deque<std::string> strings;   // deque never relocates, so the views below stay valid
+    std::unordered_map<std::string_view, uint32_t> ids;
+
+public:
+    uint32_t intern(std::string_view str);
+    bool find(std::string_view str, uint32_t& id) const;
+    const std::string& get(uint32_t id) const;
+    size_t size() const;
+};
+
+#endif // STRINGPOOL_H
@@ -0,0 +1,99 @@
+#include "TextBuffer.h"
+#include <charconv>
+
+namespace {
+
+// Fixed notation of the largest double is 309 digits before the point
+const size_t NUMBER_BUFFER = 512;
+
+} // namespace
+
+TextBuffer& TextBuffer::append(std::string_view s) {
+    text.append(s.data(), s.size());
+    return *this;
+}
+
+TextBuffer& TextBuffer::append(char c, size_t count) {
+    text.append(count, c);
+    return *this;
+}
+
+TextBuffer& TextBuffer::padRight(std::string_view s, size_t width) {
+    text.append(s.data(), s.size());
+    if (s.size() < width) {
+        text.append(width - s.size(), ' ');
+    }
+    return *this;
+}
+
+TextBuffer& TextBuffer::padLeft(std::string_view s, size_t width) {
+    if (s.size() < width) {
+        text.append(width - s.size(), ' ');
+    }
+    text.append(s.data(), s.size());
+    return *this;
+}
+
+TextBuffer& TextBuffer::appendInt(long long value, size_t width, char fill) {
+    char digits[32];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    size_t length = static_cast<size_t>(result.ptr - digits);
+    if (length < width) {
+        text.append(width - length, fill);
+    }
+    text.append(digits, length);
+    return *this;
+}
+
+TextBuffer& TextBuffer::appendFixed(double value, int precision, size_t width) {
+    char digits[NUMBER_BUFFER];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value,
+                                std::chars_format::fixed, precision);
+    size_t length = static_cast<size_t>(result.ptr - digits);
+    if (length < width) {
+        text.append(width - length, ' ');
+    }
+    text.append(digits, length);
+    return *this;
+}
+
+TextBuffer& TextBuffer::appendShortest(double value) {
+    char digits[NUMBER_BUFFER];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed);
+    text.append(digits, static_cast<size_t>(result.ptr - digits));
+    return *this;
+}
+
+void TextBuffer::padFrom(size_t start, size_t width) {
+    size_t written = text.size() - start;
+    if (written < width) {
+        text.append(width - written, ' ');
+    }
+}
+
+void TextBuffer::truncateFrom(size_t start, size_t width) {
+    if (text.size() - start > width) {
+        text.resize(start + width);
+    }
+}
+
+size_t TextBuffer::size() const {
+    return text.size();
+}
+
+void TextBuffer::reserve(size_t bytes) {
+    text.reserve(bytes);
+}
+
+void TextBuffer::clear() {
+    text.clear();
+}
+
+const std::string& TextBuffer::str() const {
+    return text;
+}
+
+void TextBuffer::flush(std::ostream& out) {
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    text.clear();
+}
@@ -0,0 +1,44 @@
+#ifndef TEXTBUFFER_H
+#define TEXTBUFFER_H
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+// Output text built up in one growable buffer and written to a stream in a
+// single call. Numbers are formatted with std::to_chars, so nothing depends
+// on stream flags or locale and no temporary strings are made per field.
+// Widths behave like std::setw: text is padded but never cut short.
+class TextBuffer {
+private:
+    std::string text;
+
+public:
+    TextBuffer& append(std::string_view s);
+    TextBuffer& append(char c, size_t count = 1);
+
+    // Left-aligned (padRight) or right-aligned (padLeft) in `width` columns
+    TextBuffer& padRight(std::string_view s, size_t width);
+    TextBuffer& padLeft(std::string_view s, size_t width);
+
+    // Right-aligned numbers; fill goes before any sign, as with std::setfill
+    TextBuffer& appendInt(long long value, size_t width = 0, char fill = ' ');
+    TextBuffer& appendFixed(double value, int precision, size_t width = 0);
+    // Fewest fixed-point digits that read back as exactly `value`
+    TextBuffer& appendShortest(double value);
+
+    // Column helpers for text appended since `start` (a size() taken earlier)
+    void padFrom(size_t start, size_t width);
+    void truncateFrom(size_t start, size_t width);
+
+    size_t size() const;
+    void reserve(size_t bytes);
+    void clear();
+    const std::string& str() const;
+
+    // Writes everything and empties the buffer, keeping its capacity
+    void flush(std::ostream& out);
+};
+
+#endif // TEXTBUFFER_H
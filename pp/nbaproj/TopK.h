@@ -0,0 +1,49 @@
+#ifndef TOPK_H
+#define TOPK_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Indices of the k rows with the highest key(row), best first. Ties go to
+// the lower index. A bounded min-heap keeps this O(n log k) and the only
+// allocation is the k-entry result.
+template <typename KeyFn>
+std::vector<size_t> topKBy(size_t count, size_t k, KeyFn key) {
+    typedef std::pair<double, size_t> Entry;
+    // True when a ranks ahead of b
+    auto better = [](const Entry& a, const Entry& b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    };
+
+    k = std::min(k, count);
+    std::vector<Entry> heap;
+    heap.reserve(k);
+    if (k == 0) {
+        return std::vector<size_t>();
+    }
+
+    // With `better` as the comparator the heap front is the worst entry kept
+    for (size_t i = 0; i < count; ++i) {
+        Entry candidate(key(i), i);
+        if (heap.size() < k) {
+            heap.push_back(candidate);
+            std::push_heap(heap.begin(), heap.end(), better);
+        } else if (better(candidate, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), better);
+            heap.back() = candidate;
+            std::push_heap(heap.begin(), heap.end(), better);
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), better);
+
+    std::vector<size_t> result;
+    result.reserve(heap.size());
+    for (const auto& entry : heap) {
+        result.push_back(entry.second);
+    }
+    return result;
+}
+
+#endif // TOPK_H
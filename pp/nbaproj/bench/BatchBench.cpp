@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "../Roster.h"
+#include "../InputValidator.h"
+#include "SyntheticRoster.h"
+
+// A bulk cut followed by renaming and moving everyone who is left
+static RosterBatch makeShakeUp() {
+    RosterBatch batch;
+    for (int i = MIN_JERSEY; i <= MAX_JERSEY; i += 2) {
+        batch.remove(i);
+    }
+    for (int i = MIN_JERSEY + 1; i <= MAX_JERSEY; i += 2) {
+        Player p("Renamed" + std::to_string(i), "Player", i, VALID_POSITIONS[(i + 1) % 5],
+                 80, 230, 26, 10.0, 6.0, 3.0);
+        batch.edit(i, p);
+    }
+    return batch;
+}
+
+static void BM_ShakeUp_OneAtATime(benchmark::State& state) {
+    const Roster base = makeSyntheticRoster(MAX_JERSEY + 1);
+    const RosterBatch batch = makeShakeUp();
+    for (auto _ : state) {
+        Roster roster = base;
+        for (const auto& op : batch.getOps()) {
+            if (op.kind == RosterBatch::OpKind::Remove) {
+                roster.removePlayer(op.jerseyNumber);
+            } else {
+                roster.editPlayer(op.jerseyNumber, op.player);
+            }
+        }
+        benchmark::DoNotOptimize(roster.getSize());
+    }
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_ShakeUp_OneAtATime);
+
+static void BM_ShakeUp_Batch(benchmark::State& state) {
+    const Roster base = makeSyntheticRoster(MAX_JERSEY + 1);
+    const RosterBatch batch = makeShakeUp();
+    for (auto _ : state) {
+        Roster roster = base;
+        benchmark::DoNotOptimize(roster.apply(batch));
+    }
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_ShakeUp_Batch);
+
+// Copying the roster is part of both runs above; this is that baseline
+static void BM_ShakeUp_CopyOnly(benchmark::State& state) {
+    const Roster base = makeSyntheticRoster(MAX_JERSEY + 1);
+    for (auto _ : state) {
+        Roster roster = base;
+        benchmark::DoNotOptimize(roster.getSize());
+    }
+}
+BENCHMARK(BM_ShakeUp_CopyOnly);
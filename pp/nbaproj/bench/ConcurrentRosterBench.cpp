@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "../ConcurrentRoster.h"
+#include "../InputValidator.h"
+#include "SyntheticRoster.h"
+
+// The kind of read a dashboard does: a jersey lookup and a position count
+static int readOnce(const Roster& roster, int jersey) {
+    const Player* p = roster.findByJersey(jersey);
+    return (p != nullptr ? p->age : 0) + roster.countAtPosition("PG");
+}
+
+// A snapshot is consistent when every index agrees with the player list
+static bool isConsistent(const Roster& roster) {
+    int counted = 0;
+    for (const auto& pos : VALID_POSITIONS) {
+        counted += roster.countAtPosition(pos);
+    }
+    if (counted != roster.getSize()) {
+        return false;
+    }
+    for (const auto& player : roster.getPlayers()) {
+        if (roster.findByJersey(player.jerseyNumber) != &player) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void BM_ConcurrentRead_Snapshot(benchmark::State& state) {
+    static ConcurrentRoster shared(makeSyntheticRoster(MAX_ROSTER_SIZE));
+    int jersey = state.thread_index();
+    for (auto _ : state) {
+        // Taking a snapshot per read bumps one shared reference count
+        ConcurrentRoster::Snapshot snap = shared.snapshot();
+        benchmark::DoNotOptimize(readOnce(*snap, jersey));
+        jersey = (jersey + 7) % MAX_ROSTER_SIZE;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentRead_Snapshot)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_ConcurrentRead_Reader(benchmark::State& state) {
+    static ConcurrentRoster shared(makeSyntheticRoster(MAX_ROSTER_SIZE));
+    ConcurrentRoster::Reader reader(shared);
+    int jersey = state.thread_index();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(readOnce(reader.current(), jersey));
+        jersey = (jersey + 7) % MAX_ROSTER_SIZE;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentRead_Reader)->ThreadRange(1, 8)->UseRealTime();
+
+// Stress run: thread 0 keeps editing, removing and re-adding players while
+// every other thread reads and checks that no snapshot is ever half-applied
+static void BM_ConcurrentReadWhileWriting(benchmark::State& state) {
+    static ConcurrentRoster shared(makeSyntheticRoster(MAX_ROSTER_SIZE));
+    bool writer = state.thread_index() == 0;
+    ConcurrentRoster::Reader reader(shared);
+    int jersey = 0;
+    int64_t writes = 0;
+    for (auto _ : state) {
+        if (writer) {
+            const Roster& now = reader.current();
+            const Player* p = now.findByJersey(jersey);
+            if (p != nullptr && writes % 2 == 0) {
+                Player moved = *p;
+                moved.position = VALID_POSITIONS[(positionIndex(p->position) + 1) % 5];
+                moved.pointsPerGame += 0.1;
+                shared.editPlayer(jersey, moved);
+            } else if (p != nullptr) {
+                Player removed = *p;
+                shared.update([&](Roster& roster) {
+                    return roster.removePlayer(removed.jerseyNumber) && roster.addPlayer(removed);
+                });
+            }
+            jersey = (jersey + 1) % MAX_ROSTER_SIZE;
+            writes++;
+        } else {
+            const Roster& now = reader.current();
+            if (now.getSize() != MAX_ROSTER_SIZE || !isConsistent(now)) {
+                state.SkipWithError("Reader saw a partially applied change");
+                break;
+            }
+        }
+    }
+    state.counters["writes"] = benchmark::Counter(static_cast<double>(writes), benchmark::Counter::kIsRate);
+    if (state.thread_index() == 0) {
+        state.counters["versions"] = static_cast<double>(shared.version());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentReadWhileWriting)->ThreadRange(2, 8)->UseRealTime();
@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include "../InputValidator.h"
+#include "../RosterFormats.h"
+#include "SyntheticRoster.h"
+
+// CSV/NDJSON export and import throughput. Exports go to a sink that keeps
+// no data and records the largest single write, which stays at the writer's
+// flush size however many players there are.
+
+static void exportSizes(benchmark::internal::Benchmark* b) {
+    b->Arg(1000)->Arg(1000000);
+    if (std::getenv("ROSTER_BENCH_LARGE") != nullptr) {
+        b->Arg(10000000);
+    }
+}
+
+class MeasuringBuf : public std::streambuf {
+public:
+    size_t written = 0;
+    size_t largestWrite = 0;
+
+protected:
+    std::streamsize xsputn(const char*, std::streamsize count) override {
+        written += static_cast<size_t>(count);
+        largestWrite = std::max(largestWrite, static_cast<size_t>(count));
+        return count;
+    }
+    int_type overflow(int_type c) override {
+        written++;
+        return c;
+    }
+};
+
+static Roster syntheticRoster(size_t count) {
+    Roster roster("Synthetic League");
+    roster.setPlayers(makeSyntheticPlayers(count));
+    return roster;
+}
+
+template <typename Writer>
+static void runExport(benchmark::State& state, Writer write) {
+    Roster roster = syntheticRoster(state.range(0));
+    MeasuringBuf sink;
+    std::ostream out(&sink);
+    for (auto _ : state) {
+        write(out, roster);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(sink.written));
+    state.counters["largest_write_kb"] = sink.largestWrite / 1024.0;
+}
+
+static void BM_ExportCsv(benchmark::State& state) {
+    runExport(state, writeRosterCsv);
+}
+BENCHMARK(BM_ExportCsv)->Apply(exportSizes)->Unit(benchmark::kMillisecond);
+
+static void BM_ExportNdjson(benchmark::State& state) {
+    runExport(state, writeRosterNdjson);
+}
+BENCHMARK(BM_ExportNdjson)->Apply(exportSizes)->Unit(benchmark::kMillisecond);
+
+// Every record is parsed and validated; past the first 15 the importer
+// rejects them as duplicate jerseys or a full roster
+template <typename Writer, typename Importer>
+static void runImport(benchmark::State& state, Writer write, Importer import) {
+    std::ostringstream out;
+    write(out, syntheticRoster(state.range(0)));
+    const std::string text = out.str();
+    for (auto _ : state) {
+        Roster roster;
+        ImportReport report;
+        import(roster, text, report, ImportOptions());
+        if (report.records != static_cast<size_t>(state.range(0)) ||
+            report.added != static_cast<size_t>(std::min<int64_t>(state.range(0), MAX_ROSTER_SIZE))) {
+            state.SkipWithError("import counts are wrong");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+static void BM_ImportCsv(benchmark::State& state) {
+    runImport(state, writeRosterCsv, importRosterCsv);
+}
+BENCHMARK(BM_ImportCsv)->Arg(1000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_ImportNdjson(benchmark::State& state) {
+    runImport(state, writeRosterNdjson, importRosterNdjson);
+}
+BENCHMARK(BM_ImportNdjson)->Arg(1000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// Export then import a full roster whose team name needs quoting and
+// escaping; the players and team must come back unchanged
+template <typename Writer, typename Importer>
+static void runRoundTrip(benchmark::State& state, Writer write, Importer import) {
+    Roster original("Los Angeles \"Showtime\", Lakers");
+    original.setPlayers(makeSyntheticPlayers(MAX_ROSTER_SIZE, 7));
+    for (auto _ : state) {
+        std::ostringstream out;
+        write(out, original);
+        Roster copy;
+        ImportReport report;
+        import(copy, out.str(), report, ImportOptions());
+
+        bool same = report.rejected == 0 && report.teamName == original.getTeamName() &&
+                    copy.getSize() == original.getSize();
+        for (int i = 0; same && i < original.getSize(); ++i) {
+            same = formatPlayerRow(copy.getPlayers()[i]) == formatPlayerRow(original.getPlayers()[i]);
+        }
+        if (!same) {
+            state.SkipWithError("round trip changed the roster");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * MAX_ROSTER_SIZE);
+}
+
+static void BM_RoundTripCsv(benchmark::State& state) {
+    runRoundTrip(state, writeRosterCsv, importRosterCsv);
+}
+BENCHMARK(BM_RoundTripCsv);
+
+static void BM_RoundTripNdjson(benchmark::State& state) {
+    runRoundTrip(state, writeRosterNdjson, importRosterNdjson);
+}
+BENCHMARK(BM_RoundTripNdjson);
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include "../FuzzyNameIndex.h"
+
+// Pronounceable random names, roughly as varied as a historical player list
+static std::string makeWord(std::mt19937& rng) {
+    static const char* syllables[] = {"an", "ber", "cor", "dan", "el", "fo", "gar", "hi",
+                                      "is", "jo", "ka", "le", "mar", "ne", "or", "pa",
+                                      "quin", "ro", "sa", "ta", "ul", "vin", "wes", "zo"};
+    std::uniform_int_distribution<int> pick(0, 23);
+    std::uniform_int_distribution<int> length(2, 4);
+    std::string word;
+    int count = length(rng);
+    for (int i = 0; i < count; ++i) {
+        word += syllables[pick(rng)];
+    }
+    return word;
+}
+
+static const FuzzyNameIndex& historicalIndex() {
+    static FuzzyNameIndex index;
+    static bool built = false;
+    if (!built) {
+        std::mt19937 rng(7);
+        for (uint32_t id = 0; id < 300000; ++id) {
+            index.insert(id, makeWord(rng), makeWord(rng));
+        }
+        built = true;
+    }
+    return index;
+}
+
+static void BM_Fuzzy_LastName(benchmark::State& state) {
+    const FuzzyNameIndex& index = historicalIndex();
+    for (auto _ : state) {
+        // One substitution away from "danquinel"
+        benchmark::DoNotOptimize(index.search("danqwinel", 2, 10));
+    }
+}
+BENCHMARK(BM_Fuzzy_LastName)->Unit(benchmark::kMillisecond);
+
+static void BM_Fuzzy_FullName(benchmark::State& state) {
+    const FuzzyNameIndex& index = historicalIndex();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.search("marle danquinel", 3, 10));
+    }
+}
+BENCHMARK(BM_Fuzzy_FullName)->Unit(benchmark::kMillisecond);
+
+static void BM_Levenshtein(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(FuzzyNameIndex::levenshtein("reeves", "reaves", 2));
+    }
+}
+BENCHMARK(BM_Levenshtein);
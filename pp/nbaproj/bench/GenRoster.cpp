@@ -0,0 +1,61 @@
+#include <charconv>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "SyntheticRoster.h"
+
+// gen_roster COUNT [FILE] [SEED]
+//
+// Writes COUNT synthetic players to FILE (default roster.txt) in the same
+// format saveRoster uses. COUNT takes a k or M suffix: 1k, 250k, 10M.
+namespace {
+
+const size_t MAX_COUNT = 100000000;
+
+bool parseCount(std::string_view text, size_t& count) {
+    size_t scale = 1;
+    if (!text.empty() && (text.back() == 'k' || text.back() == 'K')) {
+        scale = 1000;
+        text.remove_suffix(1);
+    } else if (!text.empty() && (text.back() == 'm' || text.back() == 'M')) {
+        scale = 1000000;
+        text.remove_suffix(1);
+    }
+    auto parsed = std::from_chars(text.data(), text.data() + text.size(), count);
+    if (parsed.ec != std::errc() || parsed.ptr != text.data() + text.size()) {
+        return false;
+    }
+    count *= scale;
+    return count <= MAX_COUNT;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t count = 0;
+    uint64_t seed = 1;
+    if (argc < 2 || argc > 4 || !parseCount(argv[1], count)) {
+        std::cerr << "Usage: " << argv[0] << " COUNT [FILE] [SEED]\n"
+                  << "  COUNT  players to write, e.g. 1000, 1k, 10M (at most 100M)\n"
+                  << "  FILE   output path, default roster.txt\n"
+                  << "  SEED   generator seed, default 1\n";
+        return 2;
+    }
+    std::string path = argc >= 3 ? argv[2] : "roster.txt";
+    if (argc == 4) {
+        std::string_view text = argv[3];
+        auto parsed = std::from_chars(text.data(), text.data() + text.size(), seed);
+        if (parsed.ec != std::errc() || parsed.ptr != text.data() + text.size()) {
+            std::cerr << "  Error: SEED must be a non-negative integer.\n";
+            return 2;
+        }
+    }
+
+    if (!writeSyntheticRoster(path, count, seed)) {
+        std::cerr << "  Error: Could not write " << path << ".\n";
+        return 1;
+    }
+    std::cout << "Wrote " << count << " players to " << path << "\n";
+    return 0;
+}
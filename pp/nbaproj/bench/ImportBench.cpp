@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "../InputValidator.h"
+#include "../RosterImport.h"
+#include "../RosterParser.h"
+#include "SyntheticRoster.h"
+
+// Import pipeline throughput: every record is parsed and validated, then
+// deduplicated against the roster and the rest of the file.
+
+// roster.txt-format text for `count` synthetic players
+static std::string syntheticText(size_t count) {
+    std::string path = "/tmp/roster_import_" + std::to_string(count) + ".txt";
+    writeSyntheticRoster(path, count);
+    std::ostringstream text;
+    text << std::ifstream(path, std::ios::binary).rdbuf();
+    std::remove(path.c_str());
+    return text.str();
+}
+
+// A league-sized file into an empty roster: the first 15 are added, the rest
+// are validated and then rejected as duplicate jerseys or a full roster
+static void BM_ImportRecords(benchmark::State& state) {
+    const size_t count = state.range(0);
+    const std::string text = syntheticText(count);
+    for (auto _ : state) {
+        Roster roster;
+        ImportReport report;
+        importRosterText(roster, text, report);
+        if (report.records != count || report.added != static_cast<size_t>(MAX_ROSTER_SIZE)) {
+            state.SkipWithError("import counts are wrong");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_ImportRecords)->Arg(1000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// A full roster whose every record is accepted, checked against loadRoster
+static void BM_ImportFullRoster(benchmark::State& state) {
+    const std::string text = syntheticText(MAX_ROSTER_SIZE);
+    Roster loaded;
+    ParsedRoster parsed;
+    parseRosterText(text, parsed);
+    loaded.setPlayers(std::move(parsed.players));
+
+    for (auto _ : state) {
+        Roster roster;
+        ImportReport report;
+        importRosterText(roster, text, report);
+        benchmark::DoNotOptimize(roster.getSize());
+        state.PauseTiming();
+        bool same = report.added == loaded.getPlayers().size() && report.rejected == 0;
+        for (size_t i = 0; same && i < loaded.getPlayers().size(); ++i) {
+            same = formatPlayerRow(roster.getPlayers()[i]) == formatPlayerRow(loaded.getPlayers()[i]);
+        }
+        state.ResumeTiming();
+        if (!same) {
+            state.SkipWithError("import differs from loadRoster");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * MAX_ROSTER_SIZE);
+}
+BENCHMARK(BM_ImportFullRoster);
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "../BinaryRoster.h"
+#include "../FileHandler.h"
+#include "../InputValidator.h"
+#include "../RosterParser.h"
+#include "SyntheticRoster.h"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+static void BM_LoadRoster_Stream(benchmark::State& state) {
+    std::string path = writeTempSyntheticRoster(state.range(0));
+    for (auto _ : state) {
+        Roster roster;
+        loadRosterStream(roster, path);
+        benchmark::DoNotOptimize(roster.getSize());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_LoadRoster_Stream)->Arg(1 << 18)->Unit(benchmark::kMillisecond);
+
+static void BM_LoadRoster_Mapped(benchmark::State& state) {
+    std::string path = writeTempSyntheticRoster(state.range(0));
+    for (auto _ : state) {
+        Roster roster;
+        loadRoster(roster, path);
+        benchmark::DoNotOptimize(roster.getSize());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_LoadRoster_Mapped)->Arg(1 << 18)->Unit(benchmark::kMillisecond);
+
+// Parse-only scaling: the file is read once, then parsed with Arg(0) threads
+static void BM_ParseRoster_Threads(benchmark::State& state) {
+    std::string path = writeTempSyntheticRoster(1 << 20);
+    std::ifstream file(path);
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    for (auto _ : state) {
+        ParsedRoster parsed;
+        parseRosterTextParallel(text, parsed, static_cast<unsigned>(state.range(0)));
+        benchmark::DoNotOptimize(parsed.players.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (1 << 20));
+    state.SetBytesProcessed(state.iterations() * text.size());
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_ParseRoster_Threads)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_LoadRoster_Binary(benchmark::State& state) {
+    std::string textPath = writeTempSyntheticRoster(state.range(0));
+    std::string binaryPath = textPath + ".bin";
+    convertRosterFile(textPath, binaryPath);
+    for (auto _ : state) {
+        Roster roster;
+        loadRosterBinary(roster, binaryPath);
+        benchmark::DoNotOptimize(roster.getSize());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(textPath.c_str());
+    std::remove(binaryPath.c_str());
+}
+BENCHMARK(BM_LoadRoster_Binary)->Arg(1 << 18)->Unit(benchmark::kMillisecond);
+
+// Peak resident set size of the whole process so far, in MiB
+static double peakRssMb() {
+#ifndef _WIN32
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+#else
+    return 0.0;
+#endif
+}
+
+// Reloading into the same roster, as loadRosterFlow does. Peak RSS is per
+// process, so run this one on its own (--benchmark_filter=Reload) to read it.
+static void BM_ReloadRoster(benchmark::State& state) {
+    std::string path = writeTempSyntheticRoster(state.range(0));
+    Roster roster;
+    for (auto _ : state) {
+        loadRoster(roster, path);
+        benchmark::DoNotOptimize(roster.getSize());
+    }
+    state.counters["peak_rss_mb"] = peakRssMb();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_ReloadRoster)->Arg(1 << 18)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <string>
+#include <vector>
+#include "../NameIndex.h"
+
+// Pronounceable random names so trigrams are spread like real ones
+static std::string makeName(std::mt19937& rng) {
+    static const char* syllables[] = {"an", "ber", "cor", "dan", "el", "fo", "gar", "hi",
+                                      "is", "jo", "ka", "le", "mar", "ne", "or", "pa",
+                                      "quin", "ro", "sa", "ta", "ul", "vin", "wes", "zo"};
+    std::uniform_int_distribution<int> pick(0, 23);
+    std::uniform_int_distribution<int> length(2, 4);
+    std::string name;
+    for (int part = 0; part < 2; ++part) {
+        std::string word;
+        int count = length(rng);
+        for (int i = 0; i < count; ++i) {
+            word += syllables[pick(rng)];
+        }
+        word[0] = static_cast<char>(std::toupper(word[0]));
+        name += (part == 0 ? "" : " ") + word;
+    }
+    return name;
+}
+
+static std::vector<std::string> makeNames(size_t count) {
+    std::mt19937 rng(42);
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        names.push_back(makeName(rng));
+    }
+    return names;
+}
+
+static const std::vector<std::string>& millionNames() {
+    static const std::vector<std::string> names = makeNames(1000000);
+    return names;
+}
+
+static void BM_FindByName_Scan(benchmark::State& state) {
+    const std::vector<std::string>& names = millionNames();
+    for (auto _ : state) {
+        // The pre-index approach: lowercase every name and search it
+        std::vector<uint32_t> results;
+        std::string query = "quinvin";
+        for (size_t i = 0; i < names.size(); ++i) {
+            std::string lower = names[i];
+            std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+            if (lower.find(query) != std::string::npos) {
+                results.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        benchmark::DoNotOptimize(results.data());
+    }
+}
+BENCHMARK(BM_FindByName_Scan)->Unit(benchmark::kMillisecond);
+
+static void BM_FindByName_Index(benchmark::State& state) {
+    const std::vector<std::string>& names = millionNames();
+    NameIndex index;
+    for (size_t i = 0; i < names.size(); ++i) {
+        index.insert(static_cast<uint32_t>(i), names[i]);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.find("QuinVin"));
+    }
+}
+BENCHMARK(BM_FindByName_Index)->Unit(benchmark::kMicrosecond);
+
+static void BM_FindByName_IndexCommonTrigram(benchmark::State& state) {
+    const std::vector<std::string>& names = millionNames();
+    NameIndex index;
+    for (size_t i = 0; i < names.size(); ++i) {
+        index.insert(static_cast<uint32_t>(i), names[i]);
+    }
+    // Every query trigram is common; the rarest one bounds the work
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.find("marle"));
+    }
+}
+BENCHMARK(BM_FindByName_IndexCommonTrigram)->Unit(benchmark::kMicrosecond);
+
+static void BM_NameIndex_Build(benchmark::State& state) {
+    const std::vector<std::string>& names = millionNames();
+    for (auto _ : state) {
+        NameIndex index;
+        for (size_t i = 0; i < names.size(); ++i) {
+            index.insert(static_cast<uint32_t>(i), names[i]);
+        }
+        benchmark::DoNotOptimize(index.size());
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_NameIndex_Build)->Unit(benchmark::kMillisecond)->Iterations(1);
@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "../Player.h"
+#include "../PlayerTable.h"
+#include "SyntheticRoster.h"
+
+static void BM_SumStats_Players(benchmark::State& state) {
+    std::vector<Player> players = makeSyntheticPlayers(state.range(0));
+    for (auto _ : state) {
+        double ppg = 0.0, rpg = 0.0, apg = 0.0;
+        for (const auto& p : players) {
+            ppg += p.pointsPerGame;
+            rpg += p.reboundsPerGame;
+            apg += p.assistsPerGame;
+        }
+        benchmark::DoNotOptimize(ppg + rpg + apg);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SumStats_Players)->Arg(1 << 20);
+
+static void BM_SumStats_Table(benchmark::State& state) {
+    PlayerTable table(makeSyntheticPlayers(state.range(0)));
+    const std::vector<double>& points = table.getPoints();
+    const std::vector<double>& rebounds = table.getRebounds();
+    const std::vector<double>& assists = table.getAssists();
+    for (auto _ : state) {
+        double ppg = 0.0, rpg = 0.0, apg = 0.0;
+        for (size_t i = 0; i < table.size(); ++i) {
+            ppg += points[i];
+            rpg += rebounds[i];
+            apg += assists[i];
+        }
+        benchmark::DoNotOptimize(ppg + rpg + apg);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SumStats_Table)->Arg(1 << 20);
@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "../League.h"
+#include "SyntheticRoster.h"
+
+static const League& bigLeague() {
+    static const League league = makeSyntheticLeague(1 << 20);
+    return league;
+}
+
+// position in {PF, C} and age < 27 and RPG >= 8, order by APG desc limit 5
+static void BM_Query_Materialize(benchmark::State& state) {
+    const League& league = bigLeague();
+    for (auto _ : state) {
+        std::vector<Player> matches;
+        for (size_t i = 0; i < league.getRecordCount(); ++i) {
+            Player p = league.toPlayer(static_cast<uint32_t>(i));
+            if ((p.position == "PF" || p.position == "C") && p.age < 27 && p.reboundsPerGame >= 8) {
+                matches.push_back(p);
+            }
+        }
+        std::stable_sort(matches.begin(), matches.end(), [](const Player& a, const Player& b) {
+            return a.assistsPerGame > b.assistsPerGame;
+        });
+        matches.resize(std::min<size_t>(matches.size(), 5));
+        benchmark::DoNotOptimize(matches.data());
+    }
+    state.SetItemsProcessed(state.iterations() * league.getRecordCount());
+}
+BENCHMARK(BM_Query_Materialize)->Unit(benchmark::kMillisecond);
+
+static void BM_Query_Select(benchmark::State& state) {
+    const League& league = bigLeague();
+    PlayerQuery query = PlayerQuery().positionIn({"PF", "C"})
+                                     .where(PlayerStat::Age, Compare::Less, 27)
+                                     .where(PlayerStat::Rebounds, Compare::GreaterEqual, 8)
+                                     .orderBy(PlayerStat::Assists).limit(5);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(league.select(query));
+    }
+    state.SetItemsProcessed(state.iterations() * league.getRecordCount());
+}
+BENCHMARK(BM_Query_Select)->Unit(benchmark::kMillisecond);
+
+static void BM_Query_SelectByName(benchmark::State& state) {
+    const League& league = bigLeague();
+    PlayerQuery query = PlayerQuery().nameContains("firstname4242 ")
+                                     .where(PlayerStat::Points, Compare::Greater, 10);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(league.select(query));
+    }
+}
+BENCHMARK(BM_Query_SelectByName)->Unit(benchmark::kMicrosecond);
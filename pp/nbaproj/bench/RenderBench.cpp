@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../Player.h"
+#include "../TextBuffer.h"
+#include "SyntheticRoster.h"
+
+// Stream sink that only counts bytes, so the runs measure formatting rather than I/O
+class CountingBuf : public std::streambuf {
+public:
+    size_t written = 0;
+
+protected:
+    std::streamsize xsputn(const char*, std::streamsize count) override {
+        written += static_cast<size_t>(count);
+        return count;
+    }
+    int_type overflow(int_type c) override {
+        written++;
+        return c;
+    }
+};
+
+// The stream-based formatPlayerRow this renderer replaced
+static std::string streamHeight(int inches) {
+    std::ostringstream oss;
+    oss << inches / 12 << "'" << inches % 12 << "\"";
+    return oss.str();
+}
+
+static std::string streamPlayerRow(const Player& p) {
+    std::ostringstream oss;
+    oss << "| #" << std::setw(2) << std::setfill('0') << p.jerseyNumber << " | "
+        << std::setfill(' ') << std::left << std::setw(20)
+        << (p.lastName + ", " + p.firstName).substr(0, 20) << " | "
+        << std::setw(2) << p.position << " | "
+        << std::setw(6) << streamHeight(p.heightInches) << " | "
+        << std::right << std::setw(3) << p.weightLbs << " | "
+        << std::fixed << std::setprecision(1)
+        << std::setw(5) << p.pointsPerGame << " | "
+        << std::setw(5) << p.reboundsPerGame << " | "
+        << std::setw(5) << p.assistsPerGame << " |";
+    return oss.str();
+}
+
+static void BM_RenderRows_Stream(benchmark::State& state) {
+    std::vector<Player> players = makeSyntheticPlayers(state.range(0));
+    CountingBuf sink;
+    std::ostream out(&sink);
+    for (auto _ : state) {
+        for (const auto& player : players) {
+            out << streamPlayerRow(player) << "\n";
+        }
+        out.flush();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(sink.written));
+}
+BENCHMARK(BM_RenderRows_Stream)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+static void BM_RenderRows_Buffer(benchmark::State& state) {
+    std::vector<Player> players = makeSyntheticPlayers(state.range(0));
+    CountingBuf sink;
+    std::ostream out(&sink);
+    TextBuffer buffer;
+    for (auto _ : state) {
+        for (const auto& player : players) {
+            appendPlayerRow(buffer, player);
+            buffer.append('\n');
+        }
+        buffer.flush(out);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(sink.written));
+}
+BENCHMARK(BM_RenderRows_Buffer)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include "../Roster.h"
+#include "../InputValidator.h"
+#include "SyntheticRoster.h"
+
+// Jersey lookups only mean something while every jersey has one owner, so
+// they stop at one player per number; the position scans go past that.
+static const int MAX_DISTINCT_JERSEYS = MAX_JERSEY - MIN_JERSEY + 1;
+
+static void BM_FindByJersey(benchmark::State& state) {
+    Roster roster = makeSyntheticRoster(state.range(0));
+    int jersey = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.findByJersey(jersey));
+        jersey = (jersey + 37) % (MAX_JERSEY + 1);
+    }
+}
+BENCHMARK(BM_FindByJersey)->Arg(MAX_ROSTER_SIZE)->Arg(MAX_DISTINCT_JERSEYS);
+
+static void BM_IsJerseyTaken(benchmark::State& state) {
+    Roster roster = makeSyntheticRoster(state.range(0));
+    int jersey = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.isJerseyTaken(jersey));
+        jersey = (jersey + 37) % (MAX_JERSEY + 1);
+    }
+}
+BENCHMARK(BM_IsJerseyTaken)->Arg(MAX_ROSTER_SIZE)->Arg(MAX_DISTINCT_JERSEYS);
+
+static void BM_GroupByPosition_Copy(benchmark::State& state) {
+    Roster roster = makeSyntheticRoster(state.range(0));
+    for (auto _ : state) {
+        // The old displayByPosition: one scan and one copy per position
+        for (const auto& pos : VALID_POSITIONS) {
+            benchmark::DoNotOptimize(roster.findByPosition(pos).data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GroupByPosition_Copy)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+static void BM_GroupByPosition_Buckets(benchmark::State& state) {
+    Roster roster = makeSyntheticRoster(state.range(0));
+    for (auto _ : state) {
+        for (const auto& pos : VALID_POSITIONS) {
+            roster.forEachAtPosition(pos, [](const Player& p) { benchmark::DoNotOptimize(&p); });
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GroupByPosition_Buckets)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+static void BM_FindByPosition(benchmark::State& state) {
+    Roster roster = makeSyntheticRoster(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.findByPosition("PG").data());
+    }
+}
+BENCHMARK(BM_FindByPosition)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+static void BM_ViewByPosition(benchmark::State& state) {
+    Roster roster = makeSyntheticRoster(state.range(0));
+    for (auto _ : state) {
+        for (const Player& p : roster.viewByPosition("PG")) {
+            benchmark::DoNotOptimize(&p);
+        }
+    }
+}
+BENCHMARK(BM_ViewByPosition)->RangeMultiplier(8)->Range(16, 16 << 10);
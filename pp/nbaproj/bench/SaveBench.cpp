@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../FileHandler.h"
+#include "../InputValidator.h"
+#include "../Journal.h"
+#include "SyntheticRoster.h"
+
+static void BM_SaveAfterEdit_Text(benchmark::State& state) {
+    Roster roster = makeSyntheticRoster(MAX_JERSEY + 1);
+    std::string path = "/tmp/roster_bench_save.txt";
+    Player edited = *roster.findByJersey(23);
+    for (auto _ : state) {
+        edited.pointsPerGame += 0.1;
+        roster.editPlayer(23, edited);
+        saveRoster(roster, path);
+        roster.markSaved();
+    }
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_SaveAfterEdit_Text)->Unit(benchmark::kMicrosecond);
+
+// The menu's save path: one journal entry appended per edit, with a full
+// snapshot every compactEvery entries
+static void BM_SaveAfterEdit_Journal(benchmark::State& state) {
+    Roster roster = makeSyntheticRoster(MAX_JERSEY + 1);
+    std::string journalPath = "/tmp/roster_bench_save.journal";
+    std::string snapshotPath = "/tmp/roster_bench_save_snapshot.txt";
+    RosterJournal journal(journalPath, snapshotPath);
+    journal.checkpoint(roster);
+    roster.setJournal(&journal);
+    Player edited = *roster.findByJersey(23);
+    for (auto _ : state) {
+        edited.pointsPerGame += 0.1;
+        roster.editPlayer(23, edited);
+        journal.commit(roster);
+    }
+    std::remove(journalPath.c_str());
+    std::remove(snapshotPath.c_str());
+}
+BENCHMARK(BM_SaveAfterEdit_Journal)->Unit(benchmark::kMicrosecond);
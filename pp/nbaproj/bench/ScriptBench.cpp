@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include "../Script.h"
+#include "SyntheticRoster.h"
+
+// Batch-mode throughput: a nightly-job style mix of add, edit, query and
+// remove commands, run through runScript with no terminal I/O.
+
+class NullBuf : public std::streambuf {
+protected:
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    int_type overflow(int_type c) override { return c; }
+};
+
+// Each round adds a player, edits, queries and removes them again, so the
+// roster stays the same size however many rounds run
+static std::string mixedScript(size_t rounds) {
+    std::ostringstream script;
+    for (size_t i = 0; i < rounds; ++i) {
+        int jersey = 40 + static_cast<int>(i % 50);
+        script << "add Test,Player,"  << jersey << ",SG,77,200,25,12.5,4.0,3.0\n"
+               << "edit " << jersey << " ppg=" << (i % 30) << ".5, position=SF\n"
+               << "find jersey " << jersey << "\n"
+               << "top ppg 3\n"
+               << "remove " << jersey << "\n";
+    }
+    return script.str();
+}
+
+static void BM_ScriptMixed(benchmark::State& state) {
+    const size_t rounds = state.range(0);
+    const std::string script = mixedScript(rounds);
+    NullBuf sink;
+    std::ostream out(&sink);
+    for (auto _ : state) {
+        Roster roster("Synthetic League");
+        roster.setPlayers(makeSyntheticPlayers(10));
+        std::istringstream in(script);
+        ScriptSummary summary = runScript(roster, in, out, out);
+        if (summary.failed != 0) {
+            state.SkipWithError("script commands failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rounds * 5);
+}
+BENCHMARK(BM_ScriptMixed)->Arg(2000)->Unit(benchmark::kMillisecond);
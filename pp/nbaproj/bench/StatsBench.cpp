@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "../Stats.h"
+
+static std::vector<double> makeDoubleColumn(size_t count) {
+    std::vector<double> column(count);
+    for (size_t i = 0; i < count; ++i) {
+        column[i] = static_cast<double>((i * 7919) % 500) / 10.0;
+    }
+    return column;
+}
+
+static std::vector<int> makeIntColumn(size_t count) {
+    std::vector<int> column(count);
+    for (size_t i = 0; i < count; ++i) {
+        column[i] = 150 + static_cast<int>((i * 7919) % 200);
+    }
+    return column;
+}
+
+// Arg 0 selects the SimdLevel; tests/StatsTest.cpp checks the levels agree
+template <typename T>
+static void runSummarize(benchmark::State& state, const std::vector<T>& column) {
+    setSimdLevel(static_cast<SimdLevel>(state.range(0)));
+    state.SetLabel(simdLevelName(getSimdLevel()));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(summarize(column.data(), column.size()));
+    }
+    state.SetItemsProcessed(state.iterations() * column.size());
+    setSimdLevel(getSupportedSimdLevel());
+}
+
+static void BM_SummarizeDouble(benchmark::State& state) {
+    runSummarize(state, makeDoubleColumn(1 << 20));
+}
+BENCHMARK(BM_SummarizeDouble)->DenseRange(0, 2);
+
+static void BM_SummarizeInt(benchmark::State& state) {
+    runSummarize(state, makeIntColumn(1 << 20));
+}
+BENCHMARK(BM_SummarizeInt)->DenseRange(0, 2);
+
+static void BM_Percentile(benchmark::State& state) {
+    std::vector<double> column = makeDoubleColumn(1 << 20);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(percentile(column.data(), column.size(), 90.0));
+    }
+    state.SetItemsProcessed(state.iterations() * column.size());
+}
+BENCHMARK(BM_Percentile);
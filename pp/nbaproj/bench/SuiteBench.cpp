@@ -0,0 +1,226 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../FileHandler.h"
+#include "../InputValidator.h"
+#include "../Query.h"
+#include "SyntheticRoster.h"
+
+// Regression suite over synthetic rosters of 1k, 32k and 1M players (plus
+// 10M when ROSTER_BENCH_LARGE is set). Run it with `make bench-json` to get
+// machine-readable results to compare between releases.
+
+static void rosterSizes(benchmark::internal::Benchmark* b) {
+    b->Arg(1000)->Arg(32000)->Arg(1000000);
+    if (std::getenv("ROSTER_BENCH_LARGE") != nullptr) {
+        b->Arg(10000000);
+    }
+}
+
+// Built once per size and shared, since a 1M roster takes a while to index
+static const Roster& syntheticRoster(size_t count) {
+    static std::map<size_t, std::unique_ptr<Roster>> rosters;
+    std::unique_ptr<Roster>& roster = rosters[count];
+    if (!roster) {
+        roster = std::make_unique<Roster>("Synthetic League");
+        roster->setPlayers(makeSyntheticPlayers(count));
+        roster->markSaved();
+    }
+    return *roster;
+}
+
+// Written on first use and kept between runs, since 10M players is ~500 MB
+static std::string syntheticFile(size_t count) {
+    std::string path = "/tmp/roster_suite_" + std::to_string(count) + ".txt";
+    if (!fileExists(path)) {
+        writeSyntheticRoster(path, count);
+    }
+    return path;
+}
+
+// Stream sink that only counts bytes, for rendering without terminal I/O
+class CountingBuf : public std::streambuf {
+public:
+    size_t written = 0;
+
+protected:
+    std::streamsize xsputn(const char*, std::streamsize count) override {
+        written += static_cast<size_t>(count);
+        return count;
+    }
+    int_type overflow(int_type c) override {
+        written++;
+        return c;
+    }
+};
+
+// ----- File I/O -----
+
+static void BM_Suite_LoadRoster(benchmark::State& state) {
+    std::string path = syntheticFile(state.range(0));
+    for (auto _ : state) {
+        Roster roster;
+        loadRoster(roster, path);
+        benchmark::DoNotOptimize(roster.getSize());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Suite_LoadRoster)->Apply(rosterSizes)->Unit(benchmark::kMillisecond);
+
+static void BM_Suite_SaveRoster(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    std::string path = "/tmp/roster_suite_save.txt";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(saveRoster(roster, path));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_Suite_SaveRoster)->Apply(rosterSizes)->Unit(benchmark::kMillisecond);
+
+static void BM_Suite_SplitString(benchmark::State& state) {
+    const std::string record = "Stephen,Curry,30,PG,75,185,35,26.4,4.5,5.1";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(splitString(record, ',').data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Suite_SplitString);
+
+// ----- Finders -----
+
+static void BM_Suite_FindByJersey(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    int jersey = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.findByJersey(jersey));
+        jersey = (jersey + 37) % (MAX_JERSEY + 1);
+    }
+}
+BENCHMARK(BM_Suite_FindByJersey)->Apply(rosterSizes);
+
+static void BM_Suite_IsJerseyTaken(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    int jersey = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.isJerseyTaken(jersey));
+        jersey = (jersey + 37) % (MAX_JERSEY + 1);
+    }
+}
+BENCHMARK(BM_Suite_IsJerseyTaken)->Apply(rosterSizes);
+
+static void BM_Suite_FindByName(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    size_t probe = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.findByName(syntheticNameQuery(probe)).data());
+        probe = (probe + 7919) % static_cast<size_t>(state.range(0));
+    }
+}
+BENCHMARK(BM_Suite_FindByName)->Apply(rosterSizes)->Unit(benchmark::kMicrosecond);
+
+static void BM_Suite_ViewByName(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    size_t probe = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.viewByName(syntheticNameQuery(probe)).size());
+        probe = (probe + 7919) % static_cast<size_t>(state.range(0));
+    }
+}
+BENCHMARK(BM_Suite_ViewByName)->Apply(rosterSizes)->Unit(benchmark::kMicrosecond);
+
+static void BM_Suite_FindByNameFuzzy(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    size_t probe = 0;
+    for (auto _ : state) {
+        // One dropped letter, the typo the fuzzy search exists for
+        std::string query = syntheticNameQuery(probe);
+        query.erase(query.size() - 2, 1);
+        benchmark::DoNotOptimize(roster.findByNameFuzzy(query, 10).data());
+        probe = (probe + 7919) % static_cast<size_t>(state.range(0));
+    }
+}
+BENCHMARK(BM_Suite_FindByNameFuzzy)->Apply(rosterSizes)->Unit(benchmark::kMicrosecond);
+
+static void BM_Suite_FindByPosition(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    size_t pos = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.findByPosition(VALID_POSITIONS[pos]).data());
+        pos = (pos + 1) % VALID_POSITIONS.size();
+    }
+}
+BENCHMARK(BM_Suite_FindByPosition)->Apply(rosterSizes)->Unit(benchmark::kMicrosecond);
+
+static void BM_Suite_ViewByPosition(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    size_t pos = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.viewByPosition(VALID_POSITIONS[pos]).size());
+        pos = (pos + 1) % VALID_POSITIONS.size();
+    }
+}
+BENCHMARK(BM_Suite_ViewByPosition)->Apply(rosterSizes);
+
+static void BM_Suite_Select(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    PlayerQuery query = PlayerQuery().positionIn({"PF", "C"})
+                                     .where(PlayerStat::Age, Compare::Less, 27)
+                                     .where(PlayerStat::Rebounds, Compare::GreaterEqual, 8)
+                                     .orderBy(PlayerStat::Points).limit(10);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.select(query).data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Suite_Select)->Apply(rosterSizes)->Unit(benchmark::kMicrosecond);
+
+static void BM_Suite_TopPlayers(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.topPlayers(PlayerStat::Points, 10).data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Suite_TopPlayers)->Apply(rosterSizes)->Unit(benchmark::kMicrosecond);
+
+// ----- Display -----
+
+// The full ranking displayStats sorts before printing
+static void BM_Suite_DisplayStatsSort(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(roster.topPlayers(PlayerStat::Points, roster.getSize()).data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Suite_DisplayStatsSort)->Apply(rosterSizes)->Unit(benchmark::kMillisecond);
+
+static void BM_Suite_DisplayStats(benchmark::State& state) {
+    const Roster& roster = syntheticRoster(state.range(0));
+    CountingBuf sink;
+    std::streambuf* console = std::cout.rdbuf(&sink);
+    for (auto _ : state) {
+        roster.displayStats();
+    }
+    std::cout.rdbuf(console);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(sink.written));
+}
+BENCHMARK(BM_Suite_DisplayStats)->Apply(rosterSizes)->Unit(benchmark::kMillisecond);
+
+static void BM_Suite_FormatPlayerRow(benchmark::State& state) {
+    const std::vector<Player>& players = syntheticRoster(1000).getPlayers();
+    size_t row = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(formatPlayerRow(players[row]).data());
+        row = (row + 1) % players.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Suite_FormatPlayerRow);
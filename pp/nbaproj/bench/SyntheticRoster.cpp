@@ -0,0 +1,154 @@
+#include "SyntheticRoster.h"
+#include <filesystem>
+#include <fstream>
+#include "../InputValidator.h"
+#include "../TextBuffer.h"
+
+namespace {
+
+const char* FIRST_NAMES[] = {
+    "James", "Michael", "Chris", "Anthony", "Kevin", "Stephen", "Jalen", "Jaylen",
+    "Tyrese", "Devin", "Luka", "Nikola", "Giannis", "Joel", "Jayson", "Damian",
+    "Kawhi", "Paul", "Jimmy", "Donovan", "Trae", "Zion", "Ja", "Bam",
+    "Jrue", "Kyle", "De'Aaron", "Darius", "Evan", "Scottie", "Cade", "Jaren",
+    "Marcus", "Brandon", "Jordan", "Tyler", "Mikal", "Desmond", "Keldon", "Franz",
+    "Shai", "Victor", "Alperen", "Domantas", "Rudy", "Karl-Anthony", "Andrew", "Julius",
+    "Dejounte", "Fred", "Jarrett", "Walker", "Cam", "Austin", "Derrick", "Malcolm",
+    "Immanuel", "Lauri", "Dillon", "Deandre", "Josh", "Aaron", "Bogdan", "Terry"};
+const size_t FIRST_NAME_COUNT = sizeof(FIRST_NAMES) / sizeof(FIRST_NAMES[0]);
+
+const char* SYLLABLES[] = {"an", "ber", "cor", "dan", "el", "fo", "gar", "hi",
+                           "is", "jo", "ka", "le", "mar", "ne", "or", "pa",
+                           "quin", "ro", "sa", "ta", "ul", "vin", "wes", "zo"};
+const size_t SYLLABLE_COUNT = sizeof(SYLLABLES) / sizeof(SYLLABLES[0]);
+
+// Share of players at PG, SG, SF, PF, C, in percent
+const int POSITION_SHARE[] = {20, 22, 22, 20, 16};
+
+const size_t FLUSH_BYTES = 1 << 20;
+
+// splitmix64: a well-mixed 64-bit value from any input, cheap enough per field
+uint64_t mix(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Uniform in [low, high], taken from successive bits of `bits`
+int pick(uint64_t& bits, int low, int high) {
+    int value = low + static_cast<int>(bits % static_cast<uint64_t>(high - low + 1));
+    bits = mix(bits);
+    return value;
+}
+
+// One decimal place, like hand-entered stats
+double tenths(uint64_t& bits, int lowTenths, int highTenths) {
+    return pick(bits, lowTenths, highTenths) / 10.0;
+}
+
+std::string surname(uint64_t& bits) {
+    std::string name;
+    int parts = pick(bits, 2, 3);
+    for (int i = 0; i < parts; ++i) {
+        name += SYLLABLES[pick(bits, 0, static_cast<int>(SYLLABLE_COUNT) - 1)];
+    }
+    name[0] = static_cast<char>(name[0] - 'a' + 'A');
+    return name;
+}
+
+} // namespace
+
+Player syntheticPlayer(size_t index, uint64_t seed) {
+    uint64_t bits = mix(seed * 0x100000001B3ULL ^ mix(index));
+    Player p;
+    p.firstName = InternedString(FIRST_NAMES[pick(bits, 0, static_cast<int>(FIRST_NAME_COUNT) - 1)]);
+    p.lastName = InternedString(surname(bits));
+    p.jerseyNumber = static_cast<int>(index % (MAX_JERSEY + 1));
+
+    int roll = pick(bits, 0, 99);
+    int pos = 0;
+    while (pos < 4 && roll >= POSITION_SHARE[pos]) {
+        roll -= POSITION_SHARE[pos];
+        pos++;
+    }
+    p.position = InternedString(VALID_POSITIONS[pos]);
+
+    // Guards run small and pass, bigs run tall and rebound; 72-86 in, 165-289 lbs
+    p.heightInches = pick(bits, 72, 78) + pos * 2;
+    p.weightLbs = 180 + (p.heightInches - 72) * 6 + pick(bits, -15, 25);
+    p.age = pick(bits, 19, 40);
+    p.pointsPerGame = tenths(bits, 0, pick(bits, 0, 3) == 0 ? 350 : 180);
+    p.reboundsPerGame = tenths(bits, 5, 40 + pos * 25);
+    p.assistsPerGame = tenths(bits, 0, 100 - pos * 18);
+    return p;
+}
+
+std::vector<Player> makeSyntheticPlayers(size_t count, uint64_t seed) {
+    std::vector<Player> players;
+    players.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        players.push_back(syntheticPlayer(i, seed));
+    }
+    return players;
+}
+
+std::string syntheticNameQuery(size_t index, uint64_t seed) {
+    Player p = syntheticPlayer(index, seed);
+    return p.firstName + " " + p.lastName;
+}
+
+bool writeSyntheticRoster(const std::string& path, size_t count, uint64_t seed,
+                          const std::string& teamName) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    TextBuffer out;
+    out.reserve(FLUSH_BYTES + 256);
+    out.append("TEAMNAME:").append(teamName).append('\n');
+    for (size_t i = 0; i < count; ++i) {
+        Player p = syntheticPlayer(i, seed);
+        out.append("PLAYER:").append(p.firstName.str()).append(',').append(p.lastName.str())
+           .append(',').appendInt(p.jerseyNumber).append(',').append(p.position.str())
+           .append(',').appendInt(p.heightInches).append(',').appendInt(p.weightLbs)
+           .append(',').appendInt(p.age).append(',').appendFixed(p.pointsPerGame, 1)
+           .append(',').appendFixed(p.reboundsPerGame, 1).append(',')
+           .appendFixed(p.assistsPerGame, 1).append('\n');
+        if (out.size() >= FLUSH_BYTES) {
+            out.flush(file);
+        }
+    }
+    out.flush(file);
+    file.close();
+    return !file.fail();
+}
+
+std::string writeTempSyntheticRoster(size_t count, uint64_t seed) {
+    std::string path = (std::filesystem::temp_directory_path() /
+                        ("roster_bench_" + std::to_string(count) + ".txt")).string();
+    writeSyntheticRoster(path, count, seed);
+    return path;
+}
+
+Roster makeSyntheticRoster(size_t count, uint64_t seed, const std::string& teamName) {
+    Roster roster(teamName);
+    roster.setPlayers(makeSyntheticPlayers(count, seed));
+    roster.markSaved();
+    return roster;
+}
+
+League makeSyntheticLeague(size_t count, uint64_t seed) {
+    const int teams = 30;
+    const size_t perTeamSeason = MAX_JERSEY + 1;
+    League league(static_cast<int>(perTeamSeason));
+    for (int t = 0; t < teams; ++t) {
+        league.addTeam("Team " + std::to_string(t));
+    }
+    for (size_t i = 0; i < count; ++i) {
+        league.addPlayer(static_cast<int>((i / perTeamSeason) % teams),
+                         static_cast<int>(i / (perTeamSeason * teams)), syntheticPlayer(i, seed));
+    }
+    return league;
+}
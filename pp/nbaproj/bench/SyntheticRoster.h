@@ -0,0 +1,45 @@
+#ifndef SYNTHETICROSTER_H
+#define SYNTHETICROSTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../League.h"
+#include "../Player.h"
+#include "../Roster.h"
+
+// Deterministic synthetic players for benchmarks and the gen_roster tool.
+//
+// Player i depends only on (i, seed), so a file of any size can be written
+// without holding it in memory and two runs with the same seed agree.
+// Names are drawn from common first names and syllable-built surnames so
+// trigram and fuzzy lookups see realistic spreads; stats follow the
+// position (centers are taller and rebound more, guards assist more) and
+// stay inside the ranges InputValidator accepts. Jersey numbers cycle
+// through 0-99, so rosters past 100 players repeat them, as a league file does.
+Player syntheticPlayer(size_t index, uint64_t seed = 1);
+std::vector<Player> makeSyntheticPlayers(size_t count, uint64_t seed = 1);
+
+// A name-only query likely to match a handful of the players above
+std::string syntheticNameQuery(size_t index, uint64_t seed = 1);
+
+// Writes `count` players in roster.txt format; false if the file cannot be written
+bool writeSyntheticRoster(const std::string& path, size_t count, uint64_t seed = 1,
+                          const std::string& teamName = "Synthetic League");
+
+// The same, to a scratch file in the temp directory named after `count`;
+// returns its path. Callers remove it when done.
+std::string writeTempSyntheticRoster(size_t count, uint64_t seed = 1);
+
+// A roster of players 0..count-1, loaded with setPlayers so it may pass
+// MAX_ROSTER_SIZE as a file can, and marked saved. Up to 100 players have
+// distinct jersey numbers 0..count-1.
+Roster makeSyntheticRoster(size_t count, uint64_t seed = 1,
+                           const std::string& teamName = "Synthetic League");
+
+// A league of `count` records: 100 per team and season, over 30 teams and
+// as many seasons as needed
+League makeSyntheticLeague(size_t count, uint64_t seed = 1);
+
+#endif // SYNTHETICROSTER_H
@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "../League.h"
+#include "SyntheticRoster.h"
+
+static void BM_Top10_CopyAndSort(benchmark::State& state) {
+    League league = makeSyntheticLeague(state.range(0));
+    for (auto _ : state) {
+        // The old displayStats approach: materialize every player, sort them all
+        std::vector<Player> sorted;
+        for (size_t i = 0; i < league.getRecordCount(); ++i) {
+            sorted.push_back(league.toPlayer(static_cast<uint32_t>(i)));
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const Player& a, const Player& b) {
+            return a.pointsPerGame > b.pointsPerGame;
+        });
+        sorted.resize(10);
+        benchmark::DoNotOptimize(sorted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Top10_CopyAndSort)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+static void BM_Top10_Heap(benchmark::State& state) {
+    League league = makeSyntheticLeague(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(league.topPlayers(PlayerStat::Points, 10));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Top10_Heap)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+static void BM_Top10_Composite(benchmark::State& state) {
+    League league = makeSyntheticLeague(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(league.topPlayers(StatWeights(), 10));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Top10_Composite)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../InputValidator.h"
+#include "../tests/LegacyValidators.h"
+#include "SyntheticRoster.h"
+
+// One imported record's worth of fields, with every tenth record malformed
+struct ImportFields {
+    std::string first, last, jersey, position, height, ppg;
+};
+
+static std::vector<ImportFields> makeCorpus(size_t count) {
+    static const char* broken[] = {"", " ", "12a", "1.2.3", ".", "-5", "99999999999", "P G", "Mc Donald3"};
+    std::vector<ImportFields> corpus;
+    corpus.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Player p = syntheticPlayer(i);
+        ImportFields f{p.firstName.str(), " " + p.lastName.str(), std::to_string(p.jerseyNumber),
+                       i % 3 == 0 ? "pf " : p.position.str(), std::to_string(p.heightInches),
+                       std::to_string(p.pointsPerGame).substr(0, 4)};
+        if (i % 10 == 9) {
+            std::string bad = broken[i / 10 % (sizeof(broken) / sizeof(broken[0]))];
+            (i % 20 == 19 ? f.jersey : f.ppg) = bad;
+            f.first = bad;
+        }
+        corpus.push_back(f);
+    }
+    return corpus;
+}
+
+static const std::vector<ImportFields>& corpus() {
+    static const std::vector<ImportFields> fields = makeCorpus(100000);
+    return fields;
+}
+
+// Accepted records; both forms must agree on every field for this to be a fair race
+static int validateLegacy(const ImportFields& f, std::string& name, std::string& pos) {
+    int jersey, height;
+    double ppg;
+    return legacy::validateName(f.first, name) + legacy::validateName(f.last, name) +
+           legacy::validatePositiveInt(f.jersey, jersey, MIN_JERSEY, MAX_JERSEY) +
+           legacy::validatePosition(f.position, pos) +
+           legacy::validatePositiveInt(f.height, height, 60, 96) +
+           legacy::validatePositiveDouble(f.ppg, ppg, 0.0, 50.0);
+}
+
+static int validateView(const ImportFields& f, std::string& name) {
+    int jersey, height;
+    double ppg;
+    std::string_view trimmed, pos;
+    int valid = 0;
+    if (checkName(f.first, trimmed)) {
+        capitalizeInto(trimmed, name);
+        valid++;
+    }
+    if (checkName(f.last, trimmed)) {
+        capitalizeInto(trimmed, name);
+        valid++;
+    }
+    return valid + checkJerseyNumber(f.jersey, jersey) + checkPosition(f.position, pos) +
+           checkPositiveInt(f.height, height, 60, 96) + checkPositiveDouble(f.ppg, ppg, 0.0, 50.0);
+}
+
+static void BM_ValidateImport_Legacy(benchmark::State& state) {
+    std::string name, pos;
+    for (auto _ : state) {
+        int valid = 0;
+        for (const auto& f : corpus()) {
+            valid += validateLegacy(f, name, pos);
+        }
+        benchmark::DoNotOptimize(valid);
+    }
+    state.SetItemsProcessed(state.iterations() * corpus().size());
+}
+BENCHMARK(BM_ValidateImport_Legacy)->Unit(benchmark::kMillisecond);
+
+static void BM_ValidateImport_View(benchmark::State& state) {
+    std::string legacyName, legacyPos, name;
+    for (const auto& f : corpus()) {
+        if (validateLegacy(f, legacyName, legacyPos) != validateView(f, name) || legacyName != name) {
+            state.SkipWithError("check* and legacy validators disagree");
+            return;
+        }
+    }
+    for (auto _ : state) {
+        int valid = 0;
+        for (const auto& f : corpus()) {
+            valid += validateView(f, name);
+        }
+        benchmark::DoNotOptimize(valid);
+    }
+    state.SetItemsProcessed(state.iterations() * corpus().size());
+}
+BENCHMARK(BM_ValidateImport_View)->Unit(benchmark::kMillisecond);
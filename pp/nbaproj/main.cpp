@@ -1,12 +1,21 @@
 #include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <limits>
 #include "Player.h"
 #include "Roster.h"
+#include "BinaryRoster.h"
 #include "InputValidator.h"
 #include "FileHandler.h"
+#include "Journal.h"
+#include "RosterFormats.h"
+#include "Script.h"
 
 // Function declarations
+int runScriptMode(const char* program, const char* scriptFile);
+int runConvertMode(const char* from, const char* to);
 void clearScreen();
 void pauseForUser();
 void displayMainMenu(const std::string& teamName);
@@ -23,6 +32,8 @@ void editPlayerFlow(Roster& roster);
 void searchMenu(const Roster& roster);
 void saveRosterFlow(Roster& roster);
 void loadRosterFlow(Roster& roster);
+void importPlayersFlow(Roster& roster);
+void exportRosterFlow(const Roster& roster);
 void changeTeamName(Roster& roster);
 bool handleExit(Roster& roster);
 
@@ -43,12 +54,25 @@ void editAll(Player& p, Roster& roster, int originalJersey);
 // MAIN
 // =====================================================================
 
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc == 4 && std::strcmp(argv[1], "--convert") == 0) {
+        return runConvertMode(argv[2], argv[3]);
+    }
+    if (argc > 1) {
+        return runScriptMode(argv[0], argc == 3 && std::strcmp(argv[1], "--script") == 0 ? argv[2] : nullptr);
+    }
+    
     Roster roster("Los Angeles Lakers");
+    RosterJournal journal(JOURNAL_FILE, DATA_FILE);
     
-    // Try to load existing data
-    if (loadRoster(roster, DATA_FILE)) {
+    // Try to load existing data, replaying any journaled changes on top
+    int replayed = journal.recover(roster);
+    roster.setJournal(&journal);
+    if (replayed >= 0) {
         std::cout << "\n  Loaded " << roster.getSize() << " players from '" << DATA_FILE << "'.\n";
+        if (replayed > 0) {
+            std::cout << "  Recovered " << replayed << " change(s) from '" << JOURNAL_FILE << "'.\n";
+        }
         pauseForUser();
     }
     
@@ -58,7 +82,7 @@ int main() {
         clearScreen();
         displayMainMenu(roster.getTeamName());
         
-        int choice = getMenuChoice(0, 10);
+        int choice = getMenuChoice(0, 12);
         
         switch (choice) {
             case 1:  viewFullRoster(roster); break;
@@ -71,6 +95,8 @@ int main() {
             case 8:  saveRosterFlow(roster); break;
             case 9:  loadRosterFlow(roster); break;
             case 10: changeTeamName(roster); break;
+            case 11: importPlayersFlow(roster); break;
+            case 12: exportRosterFlow(roster); break;
             case 0:  running = !handleExit(roster); break;
         }
         
@@ -87,11 +113,62 @@ int main() {
 // UTILITY FUNCTIONS
 // =====================================================================
 
+// Batch mode: the same roster and journal as the menu, with commands read
+// from `scriptFile` ("-" for stdin) instead of prompts
+int runScriptMode(const char* program, const char* scriptFile) {
+    if (scriptFile == nullptr) {
+        std::cerr << "Usage: " << program << " [--script FILE | --convert FROM TO]\n"
+                  << "  FILE   commands to run, one per line, or - for stdin (see Script.h)\n"
+                  << "  FROM   a text or binary roster, written to TO in the other format\n";
+        return 2;
+    }
+    std::ios::sync_with_stdio(false);
+    
+    std::ifstream file;
+    bool fromStdin = std::strcmp(scriptFile, "-") == 0;
+    if (!fromStdin) {
+        file.open(scriptFile);
+        if (!file.is_open()) {
+            std::cerr << "  Error: Could not open script '" << scriptFile << "'.\n";
+            return 2;
+        }
+    }
+    
+    Roster roster("Los Angeles Lakers");
+    RosterJournal journal(JOURNAL_FILE, DATA_FILE);
+    journal.recover(roster);
+    roster.setJournal(&journal);
+    
+    ScriptSummary summary = runScript(roster, fromStdin ? std::cin : file, std::cout, std::cerr);
+    if (summary.failed > 0) {
+        std::cerr << "  " << summary.failed << " of " << summary.commands << " command(s) failed.\n";
+        return 1;
+    }
+    return 0;
+}
+
+// Text <-> binary roster conversion (see BinaryRoster.h); FROM's contents
+// decide the direction
+int runConvertMode(const char* from, const char* to) {
+    if (!fileExists(from)) {
+        std::cerr << "  Error: File '" << from << "' not found.\n";
+        return 1;
+    }
+    bool toText = isBinaryRosterFile(from);
+    if (!convertRosterFile(from, to)) {
+        std::cerr << "  Error: Could not convert '" << from << "'.\n";
+        return 1;
+    }
+    std::cout << "  Wrote " << (toText ? "text" : "binary") << " roster '" << to << "'.\n";
+    return 0;
+}
+
 void clearScreen() {
     #ifdef _WIN32
         system("cls");
     #else
-        system("clear");
+        // ANSI clear and home, rather than forking a shell for clear(1) on every redraw
+        std::cout << "\033[2J\033[H";
     #endif
 }
 
@@ -120,6 +197,8 @@ void displayMainMenu(const std::string& teamName) {
     std::cout << "  [8]  Save Roster\n";
     std::cout << "  [9]  Load Roster\n";
     std::cout << "  [10] Change Team Name\n";
+    std::cout << "  [11] Import Players\n";
+    std::cout << "  [12] Export Roster (CSV/JSON)\n";
     std::cout << "  [0]  Exit\n";
     std::cout << "\n";
 }
@@ -176,8 +255,8 @@ void addPlayerFlow(Roster& roster) {
     std::cout << "                           ADD NEW PLAYER\n";
     std::cout << std::string(80, '=') << "\n";
     
-    if (roster.getRemainingSlots() == 0) {
-        std::cout << "\n  Roster is full (" << MAX_ROSTER_SIZE << "/" << MAX_ROSTER_SIZE 
+    if (roster.getRemainingSlots() <= 0) {
+        std::cout << "\n  Roster is full (" << roster.getSize() << "/" << roster.getRosterSizeCap()
                   << "). Remove a player before adding.\n";
         return;
     }
@@ -202,12 +281,12 @@ void addPlayerFlow(Roster& roster) {
     }
     
     p.position = getValidatedPosition("  Enter position (PG/SG/SF/PF/C): ");
-    p.heightInches = getValidatedInt("  Enter height in inches (60-96): ", 60, 96);
-    p.weightLbs = getValidatedInt("  Enter weight in lbs (150-350): ", 150, 350);
-    p.age = getValidatedInt("  Enter age (18-45): ", 18, 45);
-    p.pointsPerGame = getValidatedDouble("  Enter points per game (0.0-50.0): ", 0.0, 50.0);
-    p.reboundsPerGame = getValidatedDouble("  Enter rebounds per game (0.0-25.0): ", 0.0, 25.0);
-    p.assistsPerGame = getValidatedDouble("  Enter assists per game (0.0-20.0): ", 0.0, 20.0);
+    p.heightInches = getValidatedInt("  Enter height in inches (60-96): ", MIN_HEIGHT, MAX_HEIGHT);
+    p.weightLbs = getValidatedInt("  Enter weight in lbs (150-350): ", MIN_WEIGHT, MAX_WEIGHT);
+    p.age = getValidatedInt("  Enter age (18-45): ", MIN_AGE, MAX_AGE);
+    p.pointsPerGame = getValidatedDouble("  Enter points per game (0.0-50.0): ", 0.0, MAX_PPG);
+    p.reboundsPerGame = getValidatedDouble("  Enter rebounds per game (0.0-25.0): ", 0.0, MAX_RPG);
+    p.assistsPerGame = getValidatedDouble("  Enter assists per game (0.0-20.0): ", 0.0, MAX_APG);
     
     // Display summary
     std::cout << "\n  --- Player Summary ---";
@@ -273,13 +352,12 @@ void editPlayerFlow(Roster& roster) {
     
     int jersey = getValidatedJersey("\n  Enter jersey number to edit: ");
     
-    Player* p = roster.findByJersey(jersey);
+    const Player* p = roster.findByJersey(jersey);
     if (p == nullptr) {
         std::cout << "\n  No player found with jersey number " << jersey << ".\n";
         return;
     }
     
-    int originalJersey = jersey;
     bool editing = true;
     
     while (editing) {
@@ -288,14 +366,24 @@ void editPlayerFlow(Roster& roster) {
         
         int choice = getMenuChoice(0, 6);
         
+        // Edit a copy and commit it through the roster so its jersey index stays in sync
+        Player edited = *p;
+        bool changed = true;
+        
         switch (choice) {
-            case 1: editName(*p); roster.markChanged(); break;
-            case 2: editJersey(*p, roster, originalJersey); break;
-            case 3: editPosition(*p); roster.markChanged(); break;
-            case 4: editPhysical(*p); roster.markChanged(); break;
-            case 5: editStats(*p); roster.markChanged(); break;
-            case 6: editAll(*p, roster, originalJersey); break;
-            case 0: editing = false; break;
+            case 1: editName(edited); break;
+            case 2: editJersey(edited, roster, jersey); changed = edited.jerseyNumber != jersey; break;
+            case 3: editPosition(edited); break;
+            case 4: editPhysical(edited); break;
+            case 5: editStats(edited); break;
+            case 6: editAll(edited, roster, jersey); break;
+            case 0: editing = false; changed = false; break;
+        }
+        
+        if (changed) {
+            roster.editPlayer(jersey, edited);
+            jersey = edited.jerseyNumber;
+            p = roster.findByJersey(jersey);
         }
         
         if (editing && choice != 0) {
@@ -329,7 +417,10 @@ void searchMenu(const Roster& roster) {
 }
 
 void saveRosterFlow(Roster& roster) {
-    if (saveRoster(roster, DATA_FILE)) {
+    // With a journal attached only the changes since the last save are written
+    RosterJournal* journal = roster.getJournal();
+    bool saved = journal != nullptr ? journal->commit(roster) : saveRoster(roster, DATA_FILE);
+    if (saved) {
         roster.markSaved();
         std::cout << "\n  ✓ Roster saved to '" << DATA_FILE << "'.\n";
     } else {
@@ -350,16 +441,66 @@ void loadRosterFlow(Roster& roster) {
         }
     }
     
-    if (loadRoster(roster, DATA_FILE)) {
+    RosterJournal* journal = roster.getJournal();
+    bool loaded = journal != nullptr ? journal->recover(roster) >= 0 : loadRoster(roster, DATA_FILE);
+    if (loaded) {
         std::cout << "\n  ✓ Loaded " << roster.getSize() << " players from '" << DATA_FILE << "'.\n";
     } else {
         std::cout << "\n  Error loading file.\n";
     }
 }
 
+void importPlayersFlow(Roster& roster) {
+    std::string filename = getStringInput("\n  Enter file to import (.txt, .csv or .ndjson): ");
+    if (!fileExists(filename)) {
+        std::cout << "\n  File '" << filename << "' not found.\n";
+        return;
+    }
+    
+    ImportOptions options;
+    options.updateExisting = getYesNo("  Update players whose jersey is already on the roster? (Y/N): ");
+    
+    ImportReport report;
+    if (!importRosterFile(roster, filename, formatForFilename(filename), report, options)) {
+        std::cout << "\n  Error importing file.\n";
+        return;
+    }
+    
+    std::cout << "\n  Read " << report.records << " player record(s) from '" << filename << "'.\n";
+    std::cout << "  Added: " << report.added << "   Updated: " << report.updated
+              << "   Rejected: " << report.rejected << "\n";
+    
+    // The first few problems, with their line numbers so the file can be fixed
+    const size_t shown = std::min<size_t>(report.errors.size(), 20);
+    if (shown > 0) {
+        std::cout << "\n  Problems:\n";
+        for (size_t i = 0; i < shown; ++i) {
+            std::cout << "    line " << report.errors[i].line << ": " << report.errors[i].message << "\n";
+        }
+        if (report.rejected > shown) {
+            std::cout << "    ... and " << (report.rejected - shown) << " more\n";
+        }
+    }
+}
+
+void exportRosterFlow(const Roster& roster) {
+    std::string filename = getStringInput("\n  Enter file to export to (.csv or .ndjson): ");
+    RosterFormat format = formatForFilename(filename);
+    if (format == RosterFormat::Text) {
+        std::cout << "\n  Export needs a .csv, .ndjson or .jsonl file name.\n";
+        return;
+    }
+    
+    if (exportRoster(roster, filename, format)) {
+        std::cout << "\n  ✓ Exported " << roster.getSize() << " players to '" << filename << "'.\n";
+    } else {
+        std::cout << "\n  Error writing file. Check disk space and permissions.\n";
+    }
+}
+
 void changeTeamName(Roster& roster) {
     std::cout << "\n  Current team name: " << roster.getTeamName() << "\n";
-    std::string newName = getValidatedName("  Enter new team name: ");
+    std::string newName = getValidatedTeamName("  Enter new team name: ");
     roster.setTeamName(newName);
     std::cout << "\n  ✓ Team name changed to '" << newName << "'.\n";
 }
@@ -379,10 +520,19 @@ bool handleExit(Roster& roster) {
 
 void searchByName(const Roster& roster) {
     std::string name = getStringInput("\n  Enter name to search: ");
-    std::vector<Player> results = roster.findByName(name);
+    PlayerRange results = roster.viewByName(name);
     
     if (results.empty()) {
         std::cout << "\n  No players found matching '" << name << "'.\n";
+        
+        // Fall back to the closest spellings
+        std::vector<const Player*> suggestions = roster.findByNameFuzzy(name, 5);
+        if (!suggestions.empty()) {
+            std::cout << "\n  Did you mean:\n";
+            for (const Player* p : suggestions) {
+                displayPlayer(*p);
+            }
+        }
         return;
     }
     
@@ -407,7 +557,7 @@ void searchByJersey(const Roster& roster) {
 
 void searchByPosition(const Roster& roster) {
     std::string pos = getValidatedPosition("\n  Enter position (PG/SG/SF/PF/C): ");
-    std::vector<Player> results = roster.findByPosition(pos);
+    PlayerRange results = roster.viewByPosition(pos);
     
     if (results.empty()) {
         std::cout << "\n  No players found at position " << pos << ".\n";
@@ -449,7 +599,6 @@ void editJersey(Player& p, Roster& roster, int originalJersey) {
         }
         
         p.jerseyNumber = newJersey;
-        roster.markChanged();
         break;
     }
 }
@@ -462,18 +611,18 @@ void editPosition(Player& p) {
 void editPhysical(Player& p) {
     std::cout << "\n  Current: " << formatHeight(p.heightInches) << ", " 
               << p.weightLbs << " lbs, " << p.age << " years old\n";
-    p.heightInches = getValidatedInt("  New height (inches): ", 60, 96);
-    p.weightLbs = getValidatedInt("  New weight (lbs): ", 150, 350);
-    p.age = getValidatedInt("  New age: ", 18, 45);
+    p.heightInches = getValidatedInt("  New height (inches): ", MIN_HEIGHT, MAX_HEIGHT);
+    p.weightLbs = getValidatedInt("  New weight (lbs): ", MIN_WEIGHT, MAX_WEIGHT);
+    p.age = getValidatedInt("  New age: ", MIN_AGE, MAX_AGE);
 }
 
 void editStats(Player& p) {
     std::cout << "\n  Current: " << std::fixed << std::setprecision(1)
               << p.pointsPerGame << " PPG, " << p.reboundsPerGame << " RPG, "
               << p.assistsPerGame << " APG\n";
-    p.pointsPerGame = getValidatedDouble("  New PPG: ", 0.0, 50.0);
-    p.reboundsPerGame = getValidatedDouble("  New RPG: ", 0.0, 25.0);
-    p.assistsPerGame = getValidatedDouble("  New APG: ", 0.0, 20.0);
+    p.pointsPerGame = getValidatedDouble("  New PPG: ", 0.0, MAX_PPG);
+    p.reboundsPerGame = getValidatedDouble("  New RPG: ", 0.0, MAX_RPG);
+    p.assistsPerGame = getValidatedDouble("  New APG: ", 0.0, MAX_APG);
 }
 
 void editAll(Player& p, Roster& roster, int originalJersey) {
@@ -482,5 +631,4 @@ void editAll(Player& p, Roster& roster, int originalJersey) {
     editPosition(p);
     editPhysical(p);
     editStats(p);
-    roster.markChanged();
 }
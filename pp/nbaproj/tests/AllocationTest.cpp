@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "../InputValidator.h"
+#include "../Roster.h"
+
+// Counts every heap allocation this binary makes, so tests can assert what
+// a call costs. It lives in its own binary so no other suite runs under it.
+namespace {
+std::atomic<size_t> allocations(0);
+}
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+template <typename Call>
+size_t allocationsDuring(Call call) {
+    size_t before = allocations.load();
+    call();
+    return allocations.load() - before;
+}
+
+// A full roster: every first name paired with every last name, positions
+// taken in turn
+Roster makeRoster() {
+    Roster roster("Team");
+    const char* firsts[] = {"LeBron", "Anthony", "Austin"};
+    const char* lasts[] = {"James", "Davis", "Reaves", "Hachimura", "Vincent"};
+    for (int i = 0; i < 15; ++i) {
+        roster.addPlayer(Player(firsts[i % 3], lasts[i / 3], i, VALID_POSITIONS[i % 5],
+                                78, 220, 27, 10.0, 5.0, 3.0));
+    }
+    return roster;
+}
+
+const char* const QUERIES[] = {"vin", "reaves", "austin reaves", "an", "zzz"};
+
+} // namespace
+
+// Sizes are checked outside the counted calls, since a failing EXPECT
+// allocates too
+TEST(AllocationTest, ViewByPositionDoesNotAllocate) {
+    Roster roster = makeRoster();
+    size_t seen = 0;
+    size_t cost = allocationsDuring([&] {
+        for (const char* pos : {"PG", "sf", "C"}) {
+            for (const Player& p : roster.viewByPosition(pos)) {
+                seen += p.jerseyNumber >= 0;
+            }
+        }
+    });
+    EXPECT_EQ(seen, 9u);
+    EXPECT_EQ(cost, 0u);
+}
+
+TEST(AllocationTest, ViewByNameWithWarmSearchDoesNotAllocate) {
+    Roster roster = makeRoster();
+    NameSearch search;
+    for (const char* query : QUERIES) {
+        roster.viewByName(query, search);
+    }
+    size_t expected[] = {3, 3, 1, 5, 0};
+    for (size_t i = 0; i < sizeof(QUERIES) / sizeof(QUERIES[0]); ++i) {
+        const std::string query = QUERIES[i];
+        size_t matches = 0;
+        size_t cost = allocationsDuring([&] {
+            for (const Player& p : roster.viewByName(query, search)) {
+                matches += p.jerseyNumber >= 0;
+            }
+        });
+        EXPECT_EQ(matches, expected[i]) << query;
+        EXPECT_EQ(cost, 0u) << query;
+    }
+}
+
+// Without a search to reuse, the working buffers and the result are
+// allocated once per call, however many trigrams or matches there are,
+// and findByName adds only the vector of copies it returns
+TEST(AllocationTest, OwningNameQueriesStayBounded) {
+    Roster roster = makeRoster();
+    for (const char* query : QUERIES) {
+        const std::string name = query;
+        size_t view = allocationsDuring([&] { roster.viewByName(name); });
+        size_t find = allocationsDuring([&] { roster.findByName(name); });
+        EXPECT_LE(view, 6u) << query;
+        EXPECT_LE(find, view + 1) << query;
+    }
+}
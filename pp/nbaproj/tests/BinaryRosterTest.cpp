@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include "../BinaryRoster.h"
+#include "../FileHandler.h"
+#include "TempDir.h"
+
+namespace {
+
+Roster makeRoster() {
+    Roster roster("Los Angeles Lakers");
+    roster.addPlayer(Player("LeBron", "James", 23, "SF", 81, 250, 39, 25.7, 7.3, 8.3));
+    roster.addPlayer(Player("Anthony", "Davis", 3, "PF", 82, 253, 31, 24.7, 12.6, 3.5));
+    roster.addPlayer(Player("D'Angelo", "Russell", 1, "PG", 76, 193, 28, 18.0, 3.1, 0.1 + 0.2));
+    return roster;
+}
+
+void expectSamePlayers(const Roster& actual, const Roster& expected) {
+    EXPECT_EQ(actual.getTeamName(), expected.getTeamName());
+    ASSERT_EQ(actual.getSize(), expected.getSize());
+    for (const auto& p : expected.getPlayers()) {
+        const Player* q = actual.findByJersey(p.jerseyNumber);
+        ASSERT_NE(q, nullptr) << p.jerseyNumber;
+        EXPECT_EQ(q->firstName, p.firstName);
+        EXPECT_EQ(q->lastName, p.lastName);
+        EXPECT_EQ(q->position, p.position);
+        EXPECT_EQ(q->heightInches, p.heightInches);
+        EXPECT_EQ(q->weightLbs, p.weightLbs);
+        EXPECT_EQ(q->age, p.age);
+        EXPECT_EQ(q->pointsPerGame, p.pointsPerGame);   // Exact: doubles are stored bit for bit
+        EXPECT_EQ(q->reboundsPerGame, p.reboundsPerGame);
+        EXPECT_EQ(q->assistsPerGame, p.assistsPerGame);
+    }
+}
+
+std::string readBytes(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const std::string& path, const std::string& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+} // namespace
+
+TEST(BinaryRosterTest, RoundTripIsLossless) {
+    TempDir dir;
+    Roster roster = makeRoster();
+    ASSERT_TRUE(saveRosterBinary(roster, dir.path("roster.bin")));
+    EXPECT_TRUE(isBinaryRosterFile(dir.path("roster.bin")));
+
+    Roster loaded;
+    ASSERT_TRUE(loadRosterBinary(loaded, dir.path("roster.bin")));
+    expectSamePlayers(loaded, roster);
+}
+
+TEST(BinaryRosterTest, EmptyRosterRoundTrips) {
+    TempDir dir;
+    Roster roster("Empty");
+    ASSERT_TRUE(saveRosterBinary(roster, dir.path("roster.bin")));
+    Roster loaded;
+    ASSERT_TRUE(loadRosterBinary(loaded, dir.path("roster.bin")));
+    expectSamePlayers(loaded, roster);
+}
+
+TEST(BinaryRosterTest, RejectsAnyFlippedByte) {
+    TempDir dir;
+    ASSERT_TRUE(saveRosterBinary(makeRoster(), dir.path("roster.bin")));
+    const std::string original = readBytes(dir.path("roster.bin"));
+    for (size_t i = 0; i < original.size(); ++i) {
+        std::string corrupt = original;
+        corrupt[i] = static_cast<char>(corrupt[i] ^ 0x40);
+        writeBytes(dir.path("corrupt.bin"), corrupt);
+        Roster loaded("Unchanged");
+        EXPECT_FALSE(loadRosterBinary(loaded, dir.path("corrupt.bin"))) << "byte " << i;
+        EXPECT_EQ(loaded.getSize(), 0);
+        EXPECT_EQ(loaded.getTeamName(), "Unchanged");
+    }
+}
+
+TEST(BinaryRosterTest, RejectsTruncatedFile) {
+    TempDir dir;
+    ASSERT_TRUE(saveRosterBinary(makeRoster(), dir.path("roster.bin")));
+    const std::string original = readBytes(dir.path("roster.bin"));
+    for (size_t size = 0; size < original.size(); ++size) {
+        writeBytes(dir.path("short.bin"), original.substr(0, size));
+        Roster loaded;
+        EXPECT_FALSE(loadRosterBinary(loaded, dir.path("short.bin"))) << size << " bytes";
+    }
+    writeBytes(dir.path("long.bin"), original + '\0');
+    Roster loaded;
+    EXPECT_FALSE(loadRosterBinary(loaded, dir.path("long.bin")));
+}
+
+TEST(BinaryRosterTest, ConvertRoundTripsThroughText) {
+    TempDir dir;
+    Roster roster = makeRoster();
+    ASSERT_TRUE(saveRosterBinary(roster, dir.path("roster.bin")));
+    ASSERT_TRUE(convertRosterFile(dir.path("roster.bin"), dir.path("roster.txt")));
+    EXPECT_FALSE(isBinaryRosterFile(dir.path("roster.txt")));
+    ASSERT_TRUE(convertRosterFile(dir.path("roster.txt"), dir.path("again.bin")));
+    EXPECT_TRUE(isBinaryRosterFile(dir.path("again.bin")));
+
+    Roster loaded;
+    ASSERT_TRUE(loadRosterBinary(loaded, dir.path("again.bin")));
+    EXPECT_EQ(loaded.getSize(), roster.getSize());
+    EXPECT_EQ(loaded.getTeamName(), roster.getTeamName());
+    EXPECT_EQ(loaded.findByJersey(1)->lastName, "Russell");
+}
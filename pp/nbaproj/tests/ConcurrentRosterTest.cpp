@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "../ConcurrentRoster.h"
+#include "../Journal.h"
+#include "TempDir.h"
+
+namespace {
+
+Player makePlayer(int jersey) {
+    return Player("Test", "Player", jersey, "SG", 77, 200, 25, 12.5, 4.0, 3.0);
+}
+
+} // namespace
+
+TEST(ConcurrentRosterTest, FailedUpdateJournalsNothing) {
+    TempDir dir;
+    RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+    Roster initial("Team");
+    initial.setJournal(&journal);
+    ConcurrentRoster shared(initial);
+
+    bool published = shared.update([](Roster& roster) {
+        roster.addPlayer(makePlayer(10));
+        roster.addPlayer(makePlayer(11));
+        return false;
+    });
+    EXPECT_FALSE(published);
+    EXPECT_FALSE(journal.hasPending());
+    EXPECT_EQ(shared.snapshot()->getSize(), 0);
+}
+
+TEST(ConcurrentRosterTest, PublishedUpdateIsJournaled) {
+    TempDir dir;
+    RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+    Roster initial("Team");
+    initial.setJournal(&journal);
+    ConcurrentRoster shared(initial);
+
+    ASSERT_TRUE(shared.addPlayer(makePlayer(0)));
+    EXPECT_FALSE(shared.addPlayer(makePlayer(0)));
+    EXPECT_TRUE(shared.update([](Roster& roster) {
+        return roster.addPlayer(makePlayer(10)) && roster.removePlayer(0);
+    }));
+    EXPECT_EQ(shared.snapshot()->getJournal(), &journal);
+    ASSERT_TRUE(shared.commit());
+
+    Roster recovered;
+    RosterJournal reopened(dir.path("roster.journal"), dir.path("roster.txt"));
+    EXPECT_EQ(reopened.recover(recovered), 3);
+    EXPECT_EQ(recovered.getSize(), 1);
+    EXPECT_NE(recovered.findByJersey(10), nullptr);
+}
+
+// Commits, and the compactions they trigger, race with writers handing
+// entries to the journal; recovery must still rebuild the final snapshot
+TEST(ConcurrentRosterTest, CommitWhileWritersRun) {
+    TempDir dir;
+    RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"), 16);
+    Roster initial("Team", 100);
+    initial.setJournal(&journal);
+    ConcurrentRoster shared(initial);
+
+    const int WRITERS = 4;
+    std::atomic<int> running(WRITERS);
+    std::vector<std::thread> writers;
+    for (int t = 0; t < WRITERS; ++t) {
+        writers.emplace_back([&, t] {
+            // Each writer owns jerseys t, t + WRITERS, ... and toggles them,
+            // leaving its first ten on the roster
+            for (int i = 0; i < 510; ++i) {
+                int jersey = t + WRITERS * (i % 25);
+                if (!shared.addPlayer(makePlayer(jersey))) {
+                    shared.removePlayer(jersey);
+                }
+            }
+            running--;
+        });
+    }
+    int commits = 0;
+    while (running > 0) {
+        ASSERT_TRUE(shared.commit());
+        commits++;
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    ASSERT_TRUE(shared.commit());
+    EXPECT_GT(commits, 0);
+
+    ConcurrentRoster::Snapshot expected = shared.snapshot();
+    Roster recovered("", 100);
+    RosterJournal reopened(dir.path("roster.journal"), dir.path("roster.txt"));
+    ASSERT_GE(reopened.recover(recovered), 0);
+    EXPECT_EQ(expected->getSize(), WRITERS * 10);
+    EXPECT_EQ(recovered.getSize(), expected->getSize());
+    for (const Player& p : expected->getPlayers()) {
+        EXPECT_NE(recovered.findByJersey(p.jerseyNumber), nullptr) << p.jerseyNumber;
+    }
+}
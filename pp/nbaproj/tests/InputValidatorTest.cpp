@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "../InputValidator.h"
+#include "LegacyValidators.h"
+
+namespace {
+
+// Runs every check* form and its legacy counterpart on `input`; they must
+// agree on acceptance and on the result, including leaving it alone on failure
+void expectSameAsLegacy(const std::string& input) {
+    SCOPED_TRACE("input [" + input + "]");
+
+    int a = -7, b = -7;
+    EXPECT_EQ(legacy::validatePositiveInt(input, a, 0, 99), checkPositiveInt(input, b, 0, 99));
+    EXPECT_EQ(a, b);
+    a = -7, b = -7;
+    EXPECT_EQ(legacy::validatePositiveInt(input, a, 0, 2147483647), checkPositiveInt(input, b, 0, 2147483647));
+    EXPECT_EQ(a, b);
+    a = -7, b = -7;
+    EXPECT_EQ(legacy::validatePositiveInt(input, a, MIN_JERSEY, MAX_JERSEY), checkJerseyNumber(input, b));
+    EXPECT_EQ(a, b);
+
+    const double maxes[] = {50.0, 1.7976931348623157e308};
+    for (double max : maxes) {
+        double x = -1.0, y = -1.0;
+        EXPECT_EQ(legacy::validatePositiveDouble(input, x, 0.0, max), checkPositiveDouble(input, y, 0.0, max));
+        EXPECT_EQ(std::memcmp(&x, &y, sizeof(double)), 0) << x << " vs " << y;
+    }
+
+    std::string legacyPos = "?";
+    std::string_view pos = "?";
+    EXPECT_EQ(legacy::validatePosition(input, legacyPos), checkPosition(input, pos));
+    EXPECT_EQ(legacyPos, pos);
+
+    std::string legacyName = "?";
+    std::string name = "?";
+    std::string_view trimmed;
+    bool accepted = checkName(input, trimmed);
+    if (accepted) {
+        capitalizeInto(trimmed, name);
+    }
+    EXPECT_EQ(legacy::validateName(input, legacyName), accepted);
+    EXPECT_EQ(legacyName, name);
+
+    bool legacyYes = false, yes = false;
+    EXPECT_EQ(legacy::validateYesNo(input, legacyYes), checkYesNo(input, yes));
+    EXPECT_EQ(legacyYes, yes);
+}
+
+// The smallest value stod rounds to DBL_MIN without reporting underflow,
+// (2^54 - 1) * 2^-1076, as "0." and 1076 decimals
+std::string underflowBound() {
+    std::string digits = "1";   // Little-endian decimal of 2^54 - 1, then times 5^1076
+    for (int i = 0; i < 54; ++i) {
+        int carry = 0;
+        for (char& d : digits) {
+            int v = (d - '0') * 2 + carry;
+            d = static_cast<char>('0' + v % 10);
+            carry = v / 10;
+        }
+        if (carry != 0) {
+            digits.push_back(static_cast<char>('0' + carry));
+        }
+    }
+    digits[0]--;   // 2^54 ends in 4, so no borrow
+    for (int i = 0; i < 1076; ++i) {
+        int carry = 0;
+        for (char& d : digits) {
+            int v = (d - '0') * 5 + carry;
+            d = static_cast<char>('0' + v % 10);
+            carry = v / 10;
+        }
+        if (carry != 0) {
+            digits.push_back(static_cast<char>('0' + carry));
+        }
+    }
+    std::reverse(digits.begin(), digits.end());
+    return "0." + std::string(1076 - digits.size(), '0') + digits;
+}
+
+} // namespace
+
+TEST(InputValidatorTest, UnderflowBoundaryMatchesLegacy) {
+    const std::string exact = underflowBound();
+    std::string below = exact;
+    below.back()--;   // Last digit is 5
+    expectSameAsLegacy(exact);
+    expectSameAsLegacy(exact + "000");
+    expectSameAsLegacy(exact + "0001");
+    expectSameAsLegacy(below);
+    expectSameAsLegacy(below + "9999");
+    expectSameAsLegacy("000" + below);
+}
+
+TEST(InputValidatorTest, EdgeCasesMatchLegacy) {
+    const std::vector<std::string> cases = {
+        "", " ", ".", "..", "5.", ".5", "0", "00", "-5", "+5", "1e5", "0x1A", "12a", "1.2.3",
+        "2147483647", "2147483648", "99999999999", std::string(400, '9'),
+        "0." + std::string(400, '0') + "1", "0." + std::string(307, '0') + "1",
+        "0." + std::string(307, '0') + "22250738585072011", "0." + std::string(307, '0') + "22250738585072014",
+        "0." + std::string(323, '0') + "247", "1" + std::string(308, '0'),
+        "17976931348623157" + std::string(292, '0'), "17976931348623159" + std::string(292, '0'),
+        "y", "Yes", " yes ", "No", "nO\t", "yess", "pg", " c ", "Pf\t", "P G", "CC",
+        "o'neal", "mc donald", "smith-jones", "de'aaron fox", "  LeBron  ", "Mc Donald3", "-", "'"};
+    for (const auto& input : cases) {
+        expectSameAsLegacy(input);
+        expectSameAsLegacy(" " + input + "\t");
+        expectSameAsLegacy("\r\n" + input + "\n");
+    }
+}
+
+TEST(InputValidatorTest, RandomInputsMatchLegacy) {
+    std::mt19937_64 rng(22);
+    const std::string digits = "0123456789.";
+    const std::string mixed = "0123456789.  \t\n\rabcyYnNeEsSpgfcPGSFC-'+x";
+    for (int i = 0; i < 200000 && !HasFailure(); ++i) {
+        const std::string& alphabet = i % 3 == 0 ? digits : mixed;
+        std::string input(rng() % 12, ' ');
+        for (char& c : input) {
+            c = alphabet[rng() % alphabet.size()];
+        }
+        expectSameAsLegacy(input);
+    }
+}
+
+TEST(InputValidatorTest, RandomDoublesNearLimitsMatchLegacy) {
+    std::mt19937_64 rng(308);
+    for (int i = 0; i < 20000 && !HasFailure(); ++i) {
+        // Around DBL_MIN, where stod reports underflow, and up to DBL_MAX
+        std::string digits = "2225073858507201" + std::to_string(rng() % 10000);
+        if (i % 4 == 0) {
+            digits = std::to_string(rng() % 10) + std::to_string(rng());
+        }
+        expectSameAsLegacy("0." + std::string(306 + rng() % 3, '0') + digits);
+        expectSameAsLegacy(std::to_string(rng() % 100) + std::string(300 + rng() % 15, '0') + "." +
+                           std::to_string(rng() % 100));
+    }
+}
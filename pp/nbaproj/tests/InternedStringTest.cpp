@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../InputValidator.h"
+#include "../InternedString.h"
+
+TEST(InternedStringTest, PositionsArePinnedInValidPositionsOrder) {
+    EXPECT_EQ(InternedString("").getId(), 0u);
+    for (size_t i = 0; i < VALID_POSITIONS.size(); ++i) {
+        InternedString pos(VALID_POSITIONS[i]);
+        EXPECT_EQ(pos.getId(), InternedString::FIRST_POSITION_ID + i);
+        EXPECT_EQ(pos.str(), VALID_POSITIONS[i]);
+        EXPECT_EQ(positionIndex(pos), static_cast<int>(i));
+    }
+    EXPECT_EQ(positionIndex(InternedString("G")), -1);
+}
+
+TEST(InternedStringTest, LastReferenceFreesTheString) {
+    size_t before = InternedString::poolSize();
+    {
+        InternedString name("Wembanyama");
+        InternedString copy = name;
+        InternedString moved = std::move(copy);
+        InternedString again(std::string("Wembanyama"));
+        EXPECT_EQ(again, name);
+        EXPECT_EQ(moved.str(), "Wembanyama");
+        EXPECT_EQ(InternedString::poolSize(), before + 1);
+
+        name = InternedString("Gobert");
+        EXPECT_EQ(InternedString::poolSize(), before + 2);
+        EXPECT_EQ(again.str(), "Wembanyama");
+    }
+    EXPECT_EQ(InternedString::poolSize(), before);
+
+    // A freed slot can be handed out again without disturbing live strings
+    InternedString kept("Sabonis");
+    for (int i = 0; i < 1000; ++i) {
+        InternedString temp("Temporary" + std::to_string(i));
+        EXPECT_EQ(temp.str(), "Temporary" + std::to_string(i));
+    }
+    EXPECT_EQ(kept.str(), "Sabonis");
+    EXPECT_EQ(InternedString::poolSize(), before + 1);
+}
+
+TEST(InternedStringTest, ThreadsInterningTheSameNamesAgree) {
+    const int threads = 8;
+    const int names = 5000;
+    size_t before = InternedString::poolSize();
+    {
+        std::vector<std::vector<InternedString>> interned(threads);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&interned, t] {
+                for (int round = 0; round < 3; ++round) {
+                    std::vector<InternedString> mine;
+                    for (int i = 0; i < names; ++i) {
+                        // Each thread walks the names from a different start
+                        mine.emplace_back("Player" + std::to_string((i + t * 613) % names));
+                    }
+                    interned[t] = mine;
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        EXPECT_EQ(InternedString::poolSize(), before + names);
+        for (int t = 0; t < threads; ++t) {
+            for (int i = 0; i < names; ++i) {
+                const InternedString& name = interned[t][(i + names - t * 613 % names) % names];
+                EXPECT_EQ(name.str(), "Player" + std::to_string(i));
+                EXPECT_EQ(name, interned[0][i]);
+            }
+        }
+    }
+    EXPECT_EQ(InternedString::poolSize(), before);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include "../FileHandler.h"
+#include "../Journal.h"
+#include "../Roster.h"
+#include "TempDir.h"
+
+namespace {
+
+Player makePlayer(int jersey) {
+    return Player("Test", "Player", jersey, "SG", 77, 200, 25, 12.5, 4.0, 3.0);
+}
+
+} // namespace
+
+TEST(JournalTest, RecoverReplaysCommittedEntries) {
+    TempDir dir;
+    Roster roster("Team");
+    RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+    roster.setJournal(&journal);
+    ASSERT_TRUE(roster.addPlayer(makePlayer(10)));
+    ASSERT_TRUE(roster.addPlayer(makePlayer(11)));
+    ASSERT_TRUE(journal.commit(roster));
+
+    Roster recovered;
+    RosterJournal reopened(dir.path("roster.journal"), dir.path("roster.txt"));
+    EXPECT_EQ(reopened.recover(recovered), 2);
+    EXPECT_EQ(recovered.getSize(), 2);
+}
+
+// saveRoster over the snapshot of an attached journal used to leave the
+// journal in place, so recovery replayed the ADD of a player removed since
+TEST(JournalTest, SaveRosterOverSnapshotCheckpointsJournal) {
+    TempDir dir;
+    Roster roster("Team");
+    RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+    roster.setJournal(&journal);
+    ASSERT_TRUE(roster.addPlayer(makePlayer(10)));
+    ASSERT_TRUE(journal.commit(roster));
+    ASSERT_TRUE(roster.removePlayer(10));
+    ASSERT_TRUE(saveRoster(roster, dir.path("roster.txt")));
+    EXPECT_FALSE(journal.hasPending());
+    EXPECT_EQ(std::filesystem::file_size(dir.path("roster.journal")), 0u);
+
+    Roster recovered;
+    RosterJournal reopened(dir.path("roster.journal"), dir.path("roster.txt"));
+    EXPECT_EQ(reopened.recover(recovered), 0);
+    EXPECT_EQ(recovered.getSize(), 0);
+}
+
+// Replay is decided by sequence numbers alone: a journal started on a
+// snapshot with no JOURNALSEQ: line applies even if its file time is older
+TEST(JournalTest, RecoverIgnoresFileTimes) {
+    TempDir dir;
+    Roster roster("Team");
+    ASSERT_TRUE(roster.addPlayer(makePlayer(10)));
+    ASSERT_TRUE(saveRoster(roster, dir.path("roster.txt")));
+
+    RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+    roster.setJournal(&journal);
+    ASSERT_TRUE(roster.addPlayer(makePlayer(11)));
+    ASSERT_TRUE(journal.commit(roster));
+    auto saved = std::filesystem::last_write_time(dir.path("roster.txt"));
+    std::filesystem::last_write_time(dir.path("roster.journal"), saved - std::chrono::seconds(5));
+
+    Roster recovered;
+    RosterJournal reopened(dir.path("roster.journal"), dir.path("roster.txt"));
+    EXPECT_EQ(reopened.recover(recovered), 1);
+    EXPECT_EQ(recovered.getSize(), 2);
+}
+
+// A crash partway through a commit leaves some of its entries without the
+// closing COMMIT: line; none of them may be replayed
+TEST(JournalTest, RecoverDropsUnfinishedCommit) {
+    TempDir dir;
+    Roster roster("Team");
+    RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+    roster.setJournal(&journal);
+    ASSERT_TRUE(roster.addPlayer(makePlayer(10)));
+    ASSERT_TRUE(journal.commit(roster));
+    auto committed = std::filesystem::file_size(dir.path("roster.journal"));
+    {
+        std::ofstream torn(dir.path("roster.journal"), std::ios::binary | std::ios::app);
+        torn << "2:REMOVE:10\n3:ADD:Test,Player,11,SG,77,200,25,12.5,4,3\n";
+    }
+
+    Roster recovered;
+    RosterJournal reopened(dir.path("roster.journal"), dir.path("roster.txt"));
+    EXPECT_EQ(reopened.recover(recovered), 1);
+    EXPECT_NE(recovered.findByJersey(10), nullptr);
+    EXPECT_EQ(recovered.findByJersey(11), nullptr);
+    EXPECT_EQ(std::filesystem::file_size(dir.path("roster.journal")), committed);
+
+    // New commits continue after the dropped group and replay normally
+    recovered.setJournal(&reopened);
+    ASSERT_TRUE(recovered.addPlayer(makePlayer(12)));
+    ASSERT_TRUE(reopened.commit(recovered));
+    Roster again;
+    RosterJournal third(dir.path("roster.journal"), dir.path("roster.txt"));
+    EXPECT_EQ(third.recover(again), 2);
+    EXPECT_EQ(again.getSize(), 2);
+}
+
+// A snapshot from before journaling started: the newer journal still applies
+TEST(JournalTest, RecoverReplaysJournalNewerThanUnsequencedSnapshot) {
+    TempDir dir;
+    Roster roster("Team");
+    ASSERT_TRUE(roster.addPlayer(makePlayer(10)));
+    ASSERT_TRUE(saveRoster(roster, dir.path("roster.txt")));
+
+    RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+    roster.setJournal(&journal);
+    ASSERT_TRUE(roster.addPlayer(makePlayer(11)));
+    ASSERT_TRUE(journal.commit(roster));
+
+    Roster recovered;
+    RosterJournal reopened(dir.path("roster.journal"), dir.path("roster.txt"));
+    EXPECT_EQ(reopened.recover(recovered), 1);
+    EXPECT_EQ(recovered.getSize(), 2);
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "../League.h"
+
+namespace {
+
+Player makePlayer(const std::string& first, const std::string& last, int jersey) {
+    return Player(first, last, jersey, "SG", 77, 200, 25, 12.5, 4.0, 3.0);
+}
+
+} // namespace
+
+TEST(LeagueTest, UnknownTeamIdsAreRejected) {
+    League league;
+    int lakers = league.addTeam("Lakers");
+    ASSERT_TRUE(league.addPlayer(lakers, 2024, makePlayer("Austin", "Reaves", 15)));
+
+    for (int bad : {-1, 1, 1000}) {
+        EXPECT_EQ(league.getTeamName(bad), "") << bad;
+        Roster roster = league.toRoster(bad, 2024);
+        EXPECT_EQ(roster.getSize(), 0) << bad;
+        EXPECT_EQ(roster.getTeamName(), "") << bad;
+        EXPECT_EQ(league.findByJersey(bad, 2024, 15), League::NO_RECORD) << bad;
+        EXPECT_EQ(league.getTeamSize(bad, 2024), 0) << bad;
+        EXPECT_FALSE(league.removePlayer(bad, 2024, 15)) << bad;
+        EXPECT_FALSE(league.addPlayer(bad, 2024, makePlayer("Rui", "Hachimura", 28))) << bad;
+    }
+    EXPECT_EQ(league.toRoster(lakers, 2024).getSize(), 1);
+    EXPECT_EQ(league.getRecordCount(), 1u);
+}
+
+// Team -1 season 0 and team 65535 season 0 used to share a season key
+TEST(LeagueTest, NegativeTeamIdDoesNotAliasLastTeam) {
+    League league;
+    int last = -1;
+    for (int i = 0; i <= UINT16_MAX; ++i) {
+        last = league.addTeam("Team " + std::to_string(i));
+    }
+    ASSERT_EQ(last, UINT16_MAX);
+    EXPECT_EQ(league.addTeam("One Too Many"), -1);
+    EXPECT_EQ(league.findTeam("Team 12345"), 12345);
+    EXPECT_EQ(league.findTeam("Team 99999"), -1);
+
+    ASSERT_TRUE(league.addPlayer(last, 0, makePlayer("Jaxson", "Hayes", 11)));
+    EXPECT_EQ(league.findByJersey(-1, 0, 11), League::NO_RECORD);
+    EXPECT_EQ(league.toRoster(-1, 0).getSize(), 0);
+    EXPECT_FALSE(league.removePlayer(-1, 0, 11));
+    EXPECT_EQ(league.getTeamSize(last, 0), 1);
+}
+
+TEST(LeagueTest, RecordsSharePooledNamesAndReleaseThem) {
+    size_t before = InternedString::poolSize();
+    {
+        League league;
+        int team = league.addTeam("Kings");
+        ASSERT_TRUE(league.addPlayer(team, 2024, makePlayer("Domantas", "Sabonisleague", 10)));
+        ASSERT_TRUE(league.addPlayer(team, 2024, makePlayer("Keegan", "Murrayleague", 13)));
+        // The Players above are gone; only the records hold the names now
+        EXPECT_EQ(InternedString::poolSize(), before + 4);
+
+        Player copy = league.toPlayer(league.findByJersey(team, 2024, 13));
+        EXPECT_EQ(copy.lastName, "Murrayleague");
+        EXPECT_EQ(InternedString::poolSize(), before + 4);
+
+        ASSERT_TRUE(league.removePlayer(team, 2024, 10));
+        EXPECT_EQ(InternedString::poolSize(), before + 2);
+        EXPECT_EQ(league.findByName("murrayleague").size(), 1u);
+    }
+    EXPECT_EQ(InternedString::poolSize(), before);
+}
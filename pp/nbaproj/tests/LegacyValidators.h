@@ -0,0 +1,127 @@
+#ifndef LEGACYVALIDATORS_H
+#define LEGACYVALIDATORS_H
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include "../InputValidator.h"
+
+// The copying, stoi/stod-based validators the check* functions replaced.
+// ValidatorBench races them against check*; tests/InputValidatorTest.cpp
+// uses them as the reference the check* forms must agree with.
+namespace legacy {
+
+inline std::string trim(const std::string& str) {
+    size_t start = str.find_first_not_of(" \t\n\r");
+    if (start == std::string::npos) return "";
+    size_t end = str.find_last_not_of(" \t\n\r");
+    return str.substr(start, end - start + 1);
+}
+
+inline std::string toUpperCase(const std::string& str) {
+    std::string result = str;
+    std::transform(result.begin(), result.end(), result.begin(), ::toupper);
+    return result;
+}
+
+inline std::string capitalize(const std::string& str) {
+    std::string result = str;
+    bool newWord = true;
+    for (size_t i = 0; i < result.length(); ++i) {
+        if (newWord && std::isalpha(result[i])) {
+            result[i] = std::toupper(result[i]);
+            newWord = false;
+        } else if (std::isspace(result[i]) || result[i] == '-' || result[i] == '\'') {
+            newWord = true;
+        } else {
+            result[i] = std::tolower(result[i]);
+        }
+    }
+    return result;
+}
+
+inline bool isNumeric(const std::string& str) {
+    if (str.empty()) return false;
+    for (char c : str) {
+        if (!std::isdigit(c)) return false;
+    }
+    return true;
+}
+
+inline bool isAlphaOrSpecial(const std::string& str) {
+    if (str.empty()) return false;
+    for (char c : str) {
+        if (!std::isalpha(c) && c != ' ' && c != '-' && c != '\'') return false;
+    }
+    return true;
+}
+
+inline bool validatePositiveInt(const std::string& input, int& result, int min, int max) {
+    std::string trimmed = trim(input);
+    if (!isNumeric(trimmed)) return false;
+    try {
+        int num = std::stoi(trimmed);
+        if (num < min || num > max) return false;
+        result = num;
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+inline bool validatePositiveDouble(const std::string& input, double& result, double min, double max) {
+    std::string trimmed = trim(input);
+    if (trimmed.empty()) return false;
+    bool hasDot = false;
+    for (char c : trimmed) {
+        if (c == '.') {
+            if (hasDot) return false;
+            hasDot = true;
+        } else if (!std::isdigit(c)) {
+            return false;
+        }
+    }
+    try {
+        double num = std::stod(trimmed);
+        if (num < min || num > max) return false;
+        result = num;
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+inline bool validatePosition(const std::string& input, std::string& result) {
+    std::string upper = toUpperCase(trim(input));
+    for (const auto& pos : VALID_POSITIONS) {
+        if (upper == pos) {
+            result = pos;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool validateName(const std::string& input, std::string& result) {
+    std::string trimmed = trim(input);
+    if (trimmed.empty() || !isAlphaOrSpecial(trimmed)) return false;
+    result = capitalize(trimmed);
+    return true;
+}
+
+inline bool validateYesNo(const std::string& input, bool& result) {
+    std::string upper = toUpperCase(trim(input));
+    if (upper == "Y" || upper == "YES") {
+        result = true;
+        return true;
+    }
+    if (upper == "N" || upper == "NO") {
+        result = false;
+        return true;
+    }
+    return false;
+}
+
+} // namespace legacy
+
+#endif // LEGACYVALIDATORS_H
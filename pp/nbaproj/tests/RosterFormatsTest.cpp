@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "../RosterFormats.h"
+
+namespace {
+
+const std::string GOOD_RECORD =
+    "{\"team\":\"Lakers\",\"first_name\":\"LeBron\",\"last_name\":\"James\",\"jersey\":23,"
+    "\"position\":\"SF\",\"height_in\":81,\"weight_lbs\":250,\"age\":39,"
+    "\"ppg\":25.7,\"rpg\":7.3,\"apg\":8.3}\n";
+
+ImportReport importJson(Roster& roster, const std::string& text) {
+    ImportReport report;
+    importRosterNdjson(roster, text, report);
+    return report;
+}
+
+std::string replaced(std::string text, const std::string& from, const std::string& to) {
+    text.replace(text.find(from), from.size(), to);
+    return text;
+}
+
+} // namespace
+
+TEST(RosterFormatsTest, NdjsonImportsWellTypedRecord) {
+    Roster roster;
+    ImportReport report = importJson(roster, GOOD_RECORD);
+    EXPECT_EQ(report.added, 1u);
+    ASSERT_NE(roster.findByJersey(23), nullptr);
+    EXPECT_EQ(roster.findByJersey(23)->firstName, "Lebron");
+    EXPECT_EQ(report.teamName, "Lakers");
+}
+
+TEST(RosterFormatsTest, NdjsonRejectsBareLiteralForTextField) {
+    const char* literals[] = {"null", "true", "false", "42"};
+    for (const char* literal : literals) {
+        Roster roster;
+        ImportReport report = importJson(roster, replaced(GOOD_RECORD, "\"LeBron\"", literal));
+        EXPECT_EQ(report.added, 0u) << literal;
+        ASSERT_EQ(report.errors.size(), 1u) << literal;
+        EXPECT_NE(report.errors[0].message.find("'first_name' must be a JSON string"), std::string::npos)
+            << report.errors[0].message;
+    }
+
+    Roster roster;
+    ImportReport report = importJson(roster, replaced(GOOD_RECORD, "\"SF\"", "null"));
+    EXPECT_EQ(report.added, 0u);
+    EXPECT_EQ(report.rejected, 1u);
+}
+
+TEST(RosterFormatsTest, NdjsonRejectsQuotedNumber) {
+    Roster roster;
+    ImportReport report = importJson(roster, replaced(GOOD_RECORD, "\"jersey\":23", "\"jersey\":\"23\""));
+    EXPECT_EQ(report.added, 0u);
+    ASSERT_EQ(report.errors.size(), 1u);
+    EXPECT_NE(report.errors[0].message.find("'jersey' must be a JSON number"), std::string::npos);
+}
+
+TEST(RosterFormatsTest, NdjsonIgnoresTypeOfUnknownKeys) {
+    Roster roster;
+    ImportReport report = importJson(roster, replaced(GOOD_RECORD, "{", "{\"note\":null,\"id\":\"7\","));
+    EXPECT_EQ(report.added, 1u);
+}
+
+TEST(RosterFormatsTest, NdjsonRoundTripsExport) {
+    Roster roster("Lakers");
+    ASSERT_TRUE(roster.addPlayer(Player("Anthony", "Davis", 3, "PF", 82, 253, 31, 24.7, 12.6, 3.5)));
+    ASSERT_TRUE(roster.addPlayer(Player("D'Angelo", "Russell", 1, "PG", 76, 193, 28, 18.0, 3.1, 6.3)));
+    std::ostringstream out;
+    writeRosterNdjson(out, roster);
+
+    Roster imported;
+    ImportReport report = importJson(imported, out.str());
+    EXPECT_EQ(report.added, 2u);
+    EXPECT_TRUE(report.errors.empty());
+    ASSERT_NE(imported.findByJersey(1), nullptr);
+    EXPECT_EQ(imported.findByJersey(1)->firstName, "D'Angelo");
+    EXPECT_DOUBLE_EQ(imported.findByJersey(3)->reboundsPerGame, 12.6);
+}
+
+TEST(RosterFormatsTest, FailedBatchReleasesItsJerseys) {
+    Roster roster;
+    ImportReport report;
+    ImportOptions options;
+    options.batchSize = 2;
+    RosterImporter importer(roster, report, options);
+    importer.addRecord(1, "Anthony,Davis,3,PF,82,253,31,24.7,12.6,3.5");
+    // Taken behind the importer's back, so the batch holding line 1 fails
+    ASSERT_TRUE(roster.addPlayer(Player("Other", "Player", 3, "C", 80, 240, 25, 1.0, 1.0, 1.0)));
+    importer.addRecord(2, "Austin,Reaves,15,SG,77,197,26,15.9,4.3,5.5");
+    importer.addRecord(3, "Austin,Reaves,15,SG,77,197,26,15.9,4.3,5.5");
+    importer.finish();
+    EXPECT_EQ(report.added, 1u);
+    EXPECT_EQ(report.rejected, 2u);
+    ASSERT_NE(roster.findByJersey(15), nullptr);
+    for (const ImportError& error : report.errors) {
+        EXPECT_EQ(error.message.find("already used"), std::string::npos) << error.message;
+    }
+}
+
+TEST(RosterFormatsTest, ImportFillsRosterUpToItsOwnCap) {
+    Roster roster("Team", 20);
+    std::string text;
+    for (int jersey = 0; jersey < 25; ++jersey) {
+        text += "PLAYER:Austin,Reaves," + std::to_string(jersey) + ",SG,77,197,26,15.9,4.3,5.5\n";
+    }
+    ImportReport report;
+    importRosterText(roster, text, report);
+    EXPECT_EQ(report.added, 20u);
+    EXPECT_EQ(report.rejected, 5u);
+    ASSERT_FALSE(report.errors.empty());
+    EXPECT_EQ(report.errors[0].message, "roster is full (20 players)");
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include "../FileHandler.h"
+#include "../Roster.h"
+#include "TempDir.h"
+
+namespace {
+
+// A full roster: every first name paired with every last name
+Roster makeRoster() {
+    Roster roster("Team");
+    const char* firsts[] = {"LeBron", "Anthony", "Austin"};
+    const char* lasts[] = {"James", "Davis", "Reaves", "Hachimura", "Vincent"};
+    for (int i = 0; i < 15; ++i) {
+        roster.addPlayer(Player(firsts[i % 3], lasts[i / 3], i, "SF", 78, 220, 27, 10.0, 5.0, 3.0));
+    }
+    return roster;
+}
+
+} // namespace
+
+TEST(RosterTest, ViewByNameFindsSubstringMatches) {
+    Roster roster = makeRoster();
+    ASSERT_EQ(roster.getSize(), 15);
+    EXPECT_EQ(roster.viewByName("james").size(), 3u);
+    EXPECT_EQ(roster.viewByName("austin reaves").size(), 1u);
+    EXPECT_EQ(roster.viewByName("an").size(), 5u);   // Short query: scanned, not indexed
+    EXPECT_TRUE(roster.viewByName("nobody").empty());
+    for (const Player& p : roster.viewByName("vincent")) {
+        EXPECT_EQ(p.lastName, "Vincent");
+    }
+}
+
+TEST(RosterTest, ReloadReleasesNamesOfReplacedPlayers) {
+    TempDir dir;
+    std::string first = dir.path("first.txt");
+    std::string second = dir.path("second.txt");
+    {
+        std::ofstream out(first);
+        out << "TEAMNAME:First\n";
+        for (int i = 0; i < 15; ++i) {
+            out << "PLAYER:Firstload" << i << ",Onlyhere" << i << "," << i << ",PG,75,200,25,10.0,4.0,5.0\n";
+        }
+    }
+    {
+        std::ofstream out(second);
+        out << "TEAMNAME:Second\n"
+            << "PLAYER:Secondload,Player,7,C,84,260,30,12.0,11.0,2.0\n";
+    }
+
+    size_t before = InternedString::poolSize();
+    Roster roster;
+    ASSERT_TRUE(loadRoster(roster, first));
+    ASSERT_EQ(roster.getSize(), 15);
+    EXPECT_EQ(InternedString::poolSize(), before + 30);
+
+    // The first file's names are held by nothing else, so reloading frees them
+    ASSERT_TRUE(loadRoster(roster, second));
+    ASSERT_EQ(roster.getSize(), 1);
+    EXPECT_EQ(InternedString::poolSize(), before + 2);
+
+    roster.setPlayers(std::vector<Player>());
+    EXPECT_EQ(InternedString::poolSize(), before);
+}
+
+// Removal moves the last player into the gap; every index must follow it
+TEST(RosterTest, RemoveKeepsIndexesConsistent) {
+    const char* firsts[] = {"LeBron", "Anthony", "Austin", "Jaxson"};
+    const char* lasts[] = {"James", "Davis", "Reaves", "Hayes", "Vincent"};
+    Roster roster("Team", 40);
+    for (int i = 0; i < 40; ++i) {
+        ASSERT_TRUE(roster.addPlayer(Player(firsts[i % 4], lasts[i % 5], i * 2, VALID_POSITIONS[i % 5],
+                                            78, 220, 27, 10.0, 5.0, 3.0)));
+    }
+    EXPECT_FALSE(roster.addPlayer(Player("Extra", "Player", 99, "C", 78, 220, 27, 10.0, 5.0, 3.0)));
+    EXPECT_EQ(roster.getRemainingSlots(), 0);
+
+    for (int jersey : {0, 78, 40, 2, 76, 38, 50, 4}) {
+        ASSERT_TRUE(roster.removePlayer(jersey));
+        EXPECT_EQ(roster.findByJersey(jersey), nullptr);
+        const std::vector<Player>& players = roster.getPlayers();
+        for (const Player& p : players) {
+            const Player* found = roster.findByJersey(p.jerseyNumber);
+            ASSERT_NE(found, nullptr);
+            EXPECT_EQ(found->jerseyNumber, p.jerseyNumber);
+        }
+        for (const std::string& pos : VALID_POSITIONS) {
+            size_t expected = 0;
+            for (const Player& p : players) {
+                expected += p.position == pos;
+            }
+            EXPECT_EQ(roster.viewByPosition(pos).size(), expected) << pos;
+            for (const Player& p : roster.viewByPosition(pos)) {
+                EXPECT_EQ(p.position, pos);
+            }
+        }
+        for (const char* last : lasts) {
+            size_t expected = 0;
+            for (const Player& p : players) {
+                expected += p.lastName == last;
+            }
+            EXPECT_EQ(roster.viewByName(last).size(), expected) << last;
+        }
+    }
+    EXPECT_EQ(roster.getSize(), 32);
+    EXPECT_TRUE(roster.addPlayer(Player("Extra", "Player", 99, "C", 78, 220, 27, 10.0, 5.0, 3.0)));
+}
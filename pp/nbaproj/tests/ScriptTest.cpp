@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../Journal.h"
+#include "../Roster.h"
+#include "../Script.h"
+#include "TempDir.h"
+
+namespace {
+
+// One run of roster_manager --script: recover, attach the journal, run
+ScriptSummary runSession(Roster& roster, RosterJournal& journal,
+                         const std::string& script, std::string& errors) {
+    journal.recover(roster);
+    roster.setJournal(&journal);
+    std::istringstream in(script);
+    std::ostringstream out;
+    std::ostringstream err;
+    ScriptSummary summary = runScript(roster, in, out, err);
+    roster.setJournal(nullptr);
+    errors = err.str();
+    return summary;
+}
+
+} // namespace
+
+TEST(ScriptTest, SaveRosterFileByNameGoesThroughJournal) {
+    TempDir dir;
+    std::string errors;
+    {
+        Roster roster;
+        RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+        ScriptSummary summary = runSession(roster, journal,
+            "add Test,Player,10,SG,77,200,25,12.5,4.0,3.0\n"
+            "add Other,Player,11,C,84,250,30,8.0,9.0,1.0\n"
+            "save\n"
+            "remove 10\n"
+            "edit 11 ppg=20.5\n"
+            "save " + dir.path("roster.txt") + "\n", errors);
+        EXPECT_EQ(summary.failed, 0u) << errors;
+    }
+
+    // Restart: the removed player must not come back from the journal
+    Roster recovered;
+    RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+    ScriptSummary summary = runSession(recovered, journal, "", errors);
+    EXPECT_EQ(summary.failed, 0u);
+    EXPECT_EQ(recovered.getSize(), 1);
+    EXPECT_EQ(recovered.findByJersey(10), nullptr);
+    ASSERT_NE(recovered.findByJersey(11), nullptr);
+    EXPECT_DOUBLE_EQ(recovered.findByJersey(11)->pointsPerGame, 20.5);
+    EXPECT_TRUE(errors.empty()) << errors;
+}
+
+TEST(ScriptTest, PlainSaveReplaysAfterRestart) {
+    TempDir dir;
+    std::string errors;
+    {
+        Roster roster;
+        RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+        ScriptSummary summary = runSession(roster, journal,
+            "add Test,Player,10,SG,77,200,25,12.5,4.0,3.0\n"
+            "save\n"
+            "edit 10 position=PG\n"
+            "save\n", errors);
+        EXPECT_EQ(summary.failed, 0u) << errors;
+    }
+
+    Roster recovered;
+    RosterJournal journal(dir.path("roster.journal"), dir.path("roster.txt"));
+    EXPECT_EQ(journal.recover(recovered), 2);
+    ASSERT_NE(recovered.findByJersey(10), nullptr);
+    EXPECT_EQ(recovered.findByJersey(10)->position, "PG");
+}
+
+namespace {
+
+// Runs `script` against a fresh copy of the five-player roster below and
+// returns what it printed
+std::string runQuery(const std::string& script, ScriptSummary& summary, std::string& errors) {
+    Roster roster("Lakers");
+    roster.addPlayer(Player("LeBron", "James", 23, "SF", 81, 250, 39, 25.7, 7.3, 8.3));
+    roster.addPlayer(Player("Anthony", "Davis", 3, "PF", 82, 253, 31, 24.7, 12.6, 3.5));
+    roster.addPlayer(Player("Austin", "Reaves", 15, "SG", 77, 197, 26, 15.9, 4.3, 5.5));
+    roster.addPlayer(Player("Jaxson", "Hayes", 11, "C", 84, 220, 24, 4.3, 3.0, 0.5));
+    roster.addPlayer(Player("Rui", "Hachimura", 28, "PF", 80, 230, 26, 13.6, 4.3, 1.2));
+    std::istringstream in(script);
+    std::ostringstream out;
+    std::ostringstream err;
+    summary = runScript(roster, in, out, err);
+    errors = err.str();
+    return out.str();
+}
+
+// Jersey numbers of the CSV rows in `output`, in order
+std::vector<int> jerseysOf(const std::string& output) {
+    std::vector<int> jerseys;
+    std::istringstream rows(output);
+    std::string row;
+    while (std::getline(rows, row)) {
+        size_t field = 0;
+        for (int i = 0; i < 3; ++i) {
+            field = row.find(',', field) + 1;
+        }
+        jerseys.push_back(std::stoi(row.substr(field)));
+    }
+    return jerseys;
+}
+
+} // namespace
+
+TEST(ScriptTest, SelectFiltersOrdersAndLimits) {
+    ScriptSummary summary;
+    std::string errors;
+    std::string out = runQuery("select position=PF C, age<27, rpg>=3, order=apg, limit=2\n", summary, errors);
+    EXPECT_EQ(summary.failed, 0u) << errors;
+    EXPECT_EQ(jerseysOf(out), (std::vector<int>{28, 11}));
+
+    out = runQuery("select ppg>=15, order=ppg asc\n", summary, errors);
+    EXPECT_EQ(jerseysOf(out), (std::vector<int>{15, 3, 23}));
+
+    out = runQuery("select name=au\n", summary, errors);   // Austin Reaves only
+    EXPECT_EQ(jerseysOf(out), (std::vector<int>{15}));
+
+    out = runQuery("select jersey=23, ppg>30\n", summary, errors);
+    EXPECT_TRUE(out.empty());
+
+    out = runQuery("select\n", summary, errors);
+    EXPECT_EQ(jerseysOf(out).size(), 5u);
+    EXPECT_EQ(summary.failed, 0u);
+}
+
+TEST(ScriptTest, SelectRejectsBadClauses) {
+    const char* scripts[] = {
+        "select ppg\n", "select ppg>=x\n", "select height~80\n", "select name<Lee\n",
+        "select position=PG QB\n", "select order=speed\n", "select order=ppg up\n",
+        "select limit=-1\n", "select jersey=100\n", "select colour=red\n"};
+    for (const char* script : scripts) {
+        ScriptSummary summary;
+        std::string errors;
+        std::string out = runQuery(script, summary, errors);
+        EXPECT_EQ(summary.failed, 1u) << script;
+        EXPECT_TRUE(out.empty()) << script;
+        EXPECT_NE(errors.find("Error: line 1:"), std::string::npos) << script;
+    }
+}
+
+TEST(ScriptTest, TeamKeepsAnyNameAsTyped) {
+    Roster roster("Lakers");
+    std::istringstream in("team   76ers \nteam Trail Blazers (2024/25)\nteam   \n");
+    std::ostringstream out;
+    std::ostringstream err;
+    ScriptSummary summary = runScript(roster, in, out, err);
+    EXPECT_EQ(summary.failed, 1u);
+    EXPECT_NE(err.str().find("Error: line 3:"), std::string::npos) << err.str();
+    EXPECT_EQ(roster.getTeamName(), "Trail Blazers (2024/25)");
+}
+
+TEST(ScriptTest, EditReportsTakenJersey) {
+    ScriptSummary summary;
+    std::string errors;
+    runQuery("edit 23 jersey=3\nedit 23 jersey=6, ppg=99\n", summary, errors);
+    EXPECT_EQ(summary.failed, 2u);
+    EXPECT_NE(errors.find("line 1: jersey 3 is already on the roster"), std::string::npos) << errors;
+    EXPECT_EQ(errors.find("line 2: jersey"), std::string::npos) << errors;
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+#include "../Stats.h"
+
+namespace {
+
+const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+// Bitwise, so NaN results compare equal to each other
+bool sameSummary(const StatSummary& a, const StatSummary& b) {
+    return std::memcmp(&a, &b, sizeof(StatSummary)) == 0;
+}
+
+// Summarizes `column` on every level this CPU supports and expects each to
+// match the scalar result bit for bit
+template <typename T>
+void expectLevelsAgree(const std::vector<T>& column) {
+    setSimdLevel(SimdLevel::Scalar);
+    StatSummary expected = summarize(column.data(), column.size());
+    const SimdLevel levels[] = {SimdLevel::SSE2, SimdLevel::AVX2};
+    for (SimdLevel level : levels) {
+        if (level > getSupportedSimdLevel()) {
+            continue;
+        }
+        setSimdLevel(level);
+        StatSummary actual = summarize(column.data(), column.size());
+        EXPECT_TRUE(sameSummary(actual, expected))
+            << simdLevelName(level) << " on " << column.size() << " values: min " << actual.min
+            << " vs " << expected.min << ", max " << actual.max << " vs " << expected.max
+            << ", sum " << actual.sum << " vs " << expected.sum;
+    }
+    setSimdLevel(getSupportedSimdLevel());
+}
+
+} // namespace
+
+TEST(StatsTest, SimdMatchesScalarOnDoubles) {
+    std::mt19937_64 rng(4);
+    std::uniform_real_distribution<double> stat(0.0, 50.0);
+    for (size_t count = 1; count < 70; ++count) {
+        std::vector<double> column(count);
+        for (double& x : column) {
+            x = stat(rng);
+        }
+        expectLevelsAgree(column);
+    }
+    std::vector<double> large(1 << 16);
+    for (double& x : large) {
+        x = stat(rng);
+    }
+    expectLevelsAgree(large);
+}
+
+TEST(StatsTest, SimdMatchesScalarOnInts) {
+    std::mt19937 rng(4);
+    for (size_t count = 1; count < 70; ++count) {
+        std::vector<int> column(count);
+        for (int& x : column) {
+            x = 150 + static_cast<int>(rng() % 200);
+        }
+        expectLevelsAgree(column);
+    }
+}
+
+TEST(StatsTest, MinMaxSkipNaNOnEveryLevel) {
+    std::mt19937_64 rng(40);
+    std::uniform_real_distribution<double> stat(-50.0, 50.0);
+    for (size_t count = 1; count < 40; ++count) {
+        for (size_t nanAt = 0; nanAt < count; ++nanAt) {
+            std::vector<double> column(count);
+            for (double& x : column) {
+                x = stat(rng);
+            }
+            column[nanAt] = NaN;
+            expectLevelsAgree(column);
+
+            setSimdLevel(SimdLevel::Scalar);
+            StatSummary summary = summarize(column.data(), column.size());
+            EXPECT_TRUE(std::isnan(summary.sum));
+            if (count == 1) {
+                EXPECT_TRUE(std::isnan(summary.min));
+                EXPECT_TRUE(std::isnan(summary.max));
+                continue;
+            }
+            double min = std::numeric_limits<double>::infinity();
+            double max = -min;
+            for (size_t i = 0; i < count; ++i) {
+                if (i != nanAt) {
+                    min = std::min(min, column[i]);
+                    max = std::max(max, column[i]);
+                }
+            }
+            EXPECT_EQ(summary.min, min);
+            EXPECT_EQ(summary.max, max);
+        }
+    }
+    setSimdLevel(getSupportedSimdLevel());
+}
+
+TEST(StatsTest, AllNaNColumnHasNaNMinMax) {
+    std::vector<double> column(9, NaN);
+    expectLevelsAgree(column);
+    StatSummary summary = summarize(column.data(), column.size());
+    EXPECT_TRUE(std::isnan(summary.min));
+    EXPECT_TRUE(std::isnan(summary.max));
+}
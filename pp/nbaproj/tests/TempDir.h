@@ -0,0 +1,32 @@
+#ifndef TEMPDIR_H
+#define TEMPDIR_H
+
+#include <atomic>
+#include <filesystem>
+#include <string>
+#include <unistd.h>
+
+// A scratch directory for one test, removed with everything in it at the end
+class TempDir {
+private:
+    std::filesystem::path dir;
+
+public:
+    TempDir() {
+        static std::atomic<unsigned> counter(0);
+        dir = std::filesystem::temp_directory_path() /
+              ("roster_tests_" + std::to_string(::getpid()) + "_" + std::to_string(counter++));
+        std::filesystem::create_directories(dir);
+    }
+    ~TempDir() {
+        std::error_code ignored;
+        std::filesystem::remove_all(dir, ignored);
+    }
+    TempDir(const TempDir&) = delete;
+    TempDir& operator=(const TempDir&) = delete;
+
+    std::string path(const std::string& name) const { return (dir / name).string(); }
+    const std::filesystem::path& root() const { return dir; }
+};
+
+#endif // TEMPDIR_H